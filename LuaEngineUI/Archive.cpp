@@ -0,0 +1,159 @@
+#include "Archive.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+
+namespace Archive {
+
+	constexpr uint32_t kEndOfDirectory = 0x06054b50;
+	constexpr uint32_t kDirectoryEntry = 0x02014b50;
+	constexpr uint32_t kLocalHeader = 0x04034b50;
+	constexpr size_t kEndOfDirectorySize = 22;
+	constexpr size_t kDirectoryEntrySize = 46;
+	constexpr size_t kLocalHeaderSize = 30;
+	// The end record may be followed by a comment of up to 64 KiB
+	constexpr size_t kMaxComment = 0xffff;
+
+	struct Opened {
+		std::shared_ptr<const Zip> zip;
+		// The archive is opened again when it changed on disk
+		uintmax_t size = 0;
+		int64_t mtime = 0;
+		bool used = true;
+	};
+
+	static std::mutex g_Mutex;
+	static std::unordered_map<std::string, Opened> g_Open;
+
+	static uint16_t Read16(const unsigned char* p) {
+		return static_cast<uint16_t>(p[0] | p[1] << 8);
+	}
+
+	static uint32_t Read32(const unsigned char* p) {
+		return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+	}
+
+	static std::string Key(const std::string& name) {
+		std::string key = name;
+		for (char& c : key)
+			c = c == '\\' ? '/' : static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+		return key;
+	}
+
+	bool Zip::Open(const std::string& path) {
+		members.clear();
+		if (!file.Open(path) || file.Size() < kEndOfDirectorySize)
+			return false;
+		const unsigned char* data = file.Data();
+		const size_t size = file.Size();
+
+		// The end record is the last thing in the file, before its comment
+		size_t end = size - kEndOfDirectorySize;
+		const size_t stop = end > kMaxComment ? end - kMaxComment : 0;
+		while (Read32(data + end) != kEndOfDirectory) {
+			if (end == stop)
+				return false;
+			end--;
+		}
+		const size_t count = Read16(data + end + 10);
+		size_t entry = Read32(data + end + 16);
+
+		for (size_t i = 0; i < count; i++) {
+			if (entry > size || size - entry < kDirectoryEntrySize || Read32(data + entry) != kDirectoryEntry)
+				return false;
+			const unsigned char* header = data + entry;
+			const uint16_t flags = Read16(header + 8);
+			const uint16_t method = Read16(header + 10);
+			const uint32_t packed = Read32(header + 20);
+			const uint32_t length = Read32(header + 24);
+			const size_t nameLength = Read16(header + 28);
+			const size_t next = entry + kDirectoryEntrySize + nameLength + Read16(header + 30) + Read16(header + 32);
+			const size_t local = Read32(header + 42);
+			if (next > size)
+				return false;
+			const std::string name(reinterpret_cast<const char*>(header + kDirectoryEntrySize), nameLength);
+			entry = next;
+
+			// Compressed, encrypted and zip64 members and directories are skipped
+			if (method != 0 || (flags & 1) || packed != length || length == UINT32_MAX || name.empty() || name.back() == '/')
+				continue;
+			if (local > size || size - local < kLocalHeaderSize || Read32(data + local) != kLocalHeader)
+				continue;
+			const size_t offset = local + kLocalHeaderSize + Read16(data + local + 26) + Read16(data + local + 28);
+			if (offset > size || size - offset < length)
+				continue;
+			members[Key(name)] = { offset, length };
+		}
+		return true;
+	}
+
+	bool Zip::Find(const std::string& member, const unsigned char*& data, size_t& size) const {
+		auto it = members.find(Key(member));
+		if (it == members.end())
+			return false;
+		data = file.Data() + it->second.offset;
+		size = it->second.size;
+		return true;
+	}
+
+	size_t Zip::Members() const {
+		return members.size();
+	}
+
+	bool Split(const std::string& path, std::string& archive, std::string& member) {
+		for (size_t at = 0; at + 5 < path.size(); at++) {
+			const char sep = path[at + 4];
+			if (path[at] != '.' || (sep != '/' && sep != '\\'))
+				continue;
+			if (std::tolower(static_cast<unsigned char>(path[at + 1])) != 'z'
+				|| std::tolower(static_cast<unsigned char>(path[at + 2])) != 'i'
+				|| std::tolower(static_cast<unsigned char>(path[at + 3])) != 'p')
+				continue;
+			std::error_code ec;
+			if (!std::filesystem::is_regular_file(path.substr(0, at + 4), ec))
+				continue;
+			archive = path.substr(0, at + 4);
+			member = path.substr(at + 5);
+			return true;
+		}
+		return false;
+	}
+
+	std::shared_ptr<const Zip> Acquire(const std::string& archive) {
+		std::error_code ec;
+		const uintmax_t size = std::filesystem::file_size(archive, ec);
+		int64_t mtime = 0;
+		if (!ec)
+			mtime = std::filesystem::last_write_time(archive, ec).time_since_epoch().count();
+		if (ec)
+			return nullptr;
+
+		std::lock_guard lock(g_Mutex);
+		auto it = g_Open.find(archive);
+		if (it != g_Open.end() && it->second.size == size && it->second.mtime == mtime) {
+			it->second.used = true;
+			return it->second.zip;
+		}
+		auto zip = std::make_shared<Zip>();
+		if (!zip->Open(archive))
+			return nullptr;
+		g_Open[archive] = { zip, size, mtime, true };
+		return zip;
+	}
+
+	void Trim() {
+		// Decodes still running keep their archive alive through their reference
+		std::lock_guard lock(g_Mutex);
+		for (auto it = g_Open.begin(); it != g_Open.end();) {
+			if (it->second.used) {
+				it->second.used = false;
+				++it;
+			}
+			else
+				it = g_Open.erase(it);
+		}
+	}
+
+}
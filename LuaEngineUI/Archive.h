@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "FileMap.h"
+
+// Images packed into one zip file, read through a single mapping. Only stored (uncompressed)
+// members are indexed; image formats compress on their own, so `zip -0` or "store" in any archiver
+// loses nothing. A member is addressed as a path through the archive, e.g. "ui/icons.zip/sword.png".
+namespace Archive {
+
+	struct Zip {
+		bool Open(const std::string& path);
+		// The bytes of a member, which stay valid while the Zip lives
+		bool Find(const std::string& member, const unsigned char*& data, size_t& size) const;
+		size_t Members() const;
+
+	private:
+		struct Member {
+			size_t offset;
+			size_t size;
+		};
+
+		FileMap::Mapping file;
+		// By lowercased name with '/' separators
+		std::unordered_map<std::string, Member> members;
+	};
+
+	// Splits "dir/pack.zip/icons/a.png" into the archive and the member name, when the part up to
+	// ".zip" is a file.
+	bool Split(const std::string& path, std::string& archive, std::string& member);
+
+	// An open archive, shared between the threads decoding from it. Each archive is indexed once
+	// and stays mapped until a Trim finds it unused since the previous one.
+	std::shared_ptr<const Zip> Acquire(const std::string& archive);
+	void Trim();
+
+}
@@ -10,9 +10,10 @@
 #include <thread>
 #include <atlbase.h>
 #include <fstream>
+#include <bitset>
+#include <deque>
+#include <mutex>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
 #if __has_include(<detours/detours.h>)
 #include <detours/detours.h>
 #define USE_DETOURS
@@ -27,6 +28,20 @@
 
 #include "lua_core.h"
 #include "loader.h"
+#include "RetainedUI.h"
+#include "LuaProfiler.h"
+#include "LuaUI.h"
+#include "ScriptProfiler.h"
+#include "FrameBudget.h"
+#include "GcPacer.h"
+#include "IdleSkip.h"
+#include "FrameReuse.h"
+#include "InputQueue.h"
+#include "UIRate.h"
+#include "LuaTasks.h"
+#include "TextureCache.h"
+#include "Descriptors.h"
+#include "UploadRing.h"
 
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3d12.lib")
@@ -43,6 +58,8 @@ namespace D3D12 {
 	//https://github.com/ocornut/imgui/blob/master/examples/example_win32_directx12/main.cpp
 	struct FrameContext {
 		CComPtr<ID3D12CommandAllocator> command_allocator = NULL;
+		// One list per back buffer, so a recorded frame can be executed again
+		CComPtr<ID3D12GraphicsCommandList> command_list = NULL;
 		CComPtr<ID3D12Resource> main_render_target_resource = NULL;
 		D3D12_CPU_DESCRIPTOR_HANDLE main_render_target_descriptor;
 	};
@@ -54,8 +71,15 @@ namespace D3D12 {
 	static ID3D12Device* pD3DDevice = NULL;
 	static CComPtr<ID3D12DescriptorHeap> g_pD3DRtvDescHeap = NULL;
 	static CComPtr<ID3D12DescriptorHeap> g_pD3DSrvDescHeap = NULL;
+	// CPU-only twin of the SRV heap. Shader-visible heaps can't be copied from, so every SRV is
+	// created here first and copied over, and a bigger heap is filled from here.
+	static CComPtr<ID3D12DescriptorHeap> g_pD3DSrvStagingHeap = NULL;
 	static CComPtr<ID3D12CommandQueue> g_pD3DCommandQueue = NULL;
-	static CComPtr<ID3D12GraphicsCommandList> g_pD3DCommandList = NULL;
+	static CComPtr<ID3D12Fence> g_pD3DFence = NULL;
+	static UINT64 g_FenceValue = 0;
+	static HANDLE g_FenceEvent = NULL;
+	static ImDrawData* g_LastDrawData = NULL;
+	static uint64_t g_LastDrawBuild = 0;
 
 	LRESULT APIENTRY WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -74,16 +98,284 @@ namespace D3D12 {
 	static uint64_t* g_MethodsTable = NULL;
 	static bool g_Initialized = false;
 
-	static int descriptor_index = 1;
-	static bool LoadTextureFromFile(const char* filename, ID3D12Device* d3d_device, D3D12_CPU_DESCRIPTOR_HANDLE srv_cpu_handle, ID3D12Resource** out_tex_resource, int* out_width, int* out_height)
+	// SRV heap slots. Slot 0 holds the font; the heaps double when they run out.
+	constexpr UINT kInitialSrvDescriptors = 64;
+	static Descriptors::Allocator g_SrvSlots;
+	static UINT g_SrvIncrement = 0;
+	static bool g_FontSrvCopied = false;
+	// Heaps replaced by bigger ones, with the GPU range each covered. They stay alive until the
+	// next reset, so their addresses can't be handed out again and draw data built against them
+	// can be rebased.
+	static std::vector<CComPtr<ID3D12DescriptorHeap>> g_OldSrvHeaps;
+	static std::vector<std::pair<UINT64, UINT64>> g_OldSrvRanges;
+	// Held while the heaps are written or replaced, and while a frame is recorded against them
+	static std::mutex g_SrvMutex;
+
+	static D3D12_CPU_DESCRIPTOR_HANDLE SrvCpuHandle(ID3D12DescriptorHeap* heap, UINT slot) {
+		D3D12_CPU_DESCRIPTOR_HANDLE handle = heap->GetCPUDescriptorHandleForHeapStart();
+		handle.ptr += (SIZE_T)g_SrvIncrement * slot;
+		return handle;
+	}
+
+	static bool CreateSrvHeap(UINT count, D3D12_DESCRIPTOR_HEAP_FLAGS flags, CComPtr<ID3D12DescriptorHeap>& heap) {
+		D3D12_DESCRIPTOR_HEAP_DESC desc = {};
+		desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+		desc.NumDescriptors = count;
+		desc.Flags = flags;
+		return pD3DDevice->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&heap)) == S_OK;
+	}
+
+	// Moves every SRV into heaps of `count` descriptors. Slots keep their index. Call with
+	// g_SrvMutex held, on the thread that owns the ImGui context.
+	static bool GrowSrvHeaps(UINT count) {
+		CComPtr<ID3D12DescriptorHeap> visible;
+		CComPtr<ID3D12DescriptorHeap> staging;
+		if (!CreateSrvHeap(count, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, visible) || !CreateSrvHeap(count, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, staging))
+			return false;
+		const UINT old = g_pD3DSrvStagingHeap->GetDesc().NumDescriptors;
+		pD3DDevice->CopyDescriptorsSimple(old, SrvCpuHandle(staging, 0), SrvCpuHandle(g_pD3DSrvStagingHeap, 0), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+		pD3DDevice->CopyDescriptorsSimple(old, SrvCpuHandle(visible, 0), SrvCpuHandle(g_pD3DSrvStagingHeap, 0), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+		const UINT64 begin = g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart().ptr;
+		g_OldSrvRanges.push_back({ begin, begin + (UINT64)g_SrvIncrement * old });
+		g_OldSrvHeaps.push_back(g_pD3DSrvDescHeap);
+		g_OldSrvHeaps.push_back(g_pD3DSrvStagingHeap);
+		g_pD3DSrvDescHeap = visible;
+		g_pD3DSrvStagingHeap = staging;
+		g_SrvSlots.Grow(count);
+		ImGui::GetIO().Fonts->SetTexID((ImTextureID)g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart().ptr);
+		loader::LOG(loader::INFO) << "[LuaEngineUI] SRV heap grown to " << count << " descriptors";
+		return true;
+	}
+
+	// Draw data built before a heap grew still points into the old one. Call with g_SrvMutex held.
+	static void RebaseTextures(ImDrawData& data) {
+		if (g_OldSrvRanges.empty())
+			return;
+		const UINT64 begin = g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart().ptr;
+		for (int i = 0; i < data.CmdListsCount; i++) {
+			for (ImDrawCmd& cmd : data.CmdLists[i]->CmdBuffer) {
+				const UINT64 id = (UINT64)cmd.TextureId;
+				for (const auto& [oldBegin, oldEnd] : g_OldSrvRanges) {
+					if (id >= oldBegin && id < oldEnd) {
+						cmd.TextureId = (ImTextureID)(begin + (id - oldBegin));
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	// Texture uploads. Copies are recorded into one list for a copy queue and submitted with the
+	// next frame, whose queue waits for them on the GPU. Staging memory comes from a persistent
+	// ring; each batch's part of it is reused once the copy fence passed the batch.
+	constexpr UINT64 kUploadRingSize = 16 << 20;
+	static CComPtr<ID3D12CommandQueue> g_pCopyQueue = NULL;
+	static CComPtr<ID3D12Fence> g_pCopyFence = NULL;
+	static UINT64 g_CopyFenceValue = 0;
+	static CComPtr<ID3D12GraphicsCommandList> g_pCopyList = NULL;
+	static bool g_CopyListOpen = false;
+	static CComPtr<ID3D12Resource> g_pUploadRing = NULL;
+	static unsigned char* g_UploadRingData = NULL;
+	static UploadRing::Ring g_UploadRing;
+	// Allocators of submitted batches, oldest first
+	struct CopyAllocator {
+		CComPtr<ID3D12CommandAllocator> allocator;
+		UINT64 fence;
+	};
+	static std::deque<CopyAllocator> g_CopyAllocators;
+	// Staging buffers for uploads the ring had no room for, freed with their batch
+	struct OversizeUpload {
+		CComPtr<ID3D12Resource> buffer;
+		UINT64 fence;
+	};
+	static std::vector<OversizeUpload> g_OversizeUploads;
+	// The open batch writes into textures that frames in flight may sample
+	static bool g_CopyTouchesLiveTextures = false;
+	// Held while copies are recorded or submitted; a script may load a texture from a game callback
+	static std::mutex g_UploadMutex;
+
+	static bool CreateUploadBuffer(UINT64 size, CComPtr<ID3D12Resource>& buffer, unsigned char*& data) {
+		D3D12_HEAP_PROPERTIES props = {};
+		props.Type = D3D12_HEAP_TYPE_UPLOAD;
+		props.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+		props.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+
+		D3D12_RESOURCE_DESC desc = {};
+		desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+		desc.Width = size;
+		desc.Height = 1;
+		desc.DepthOrArraySize = 1;
+		desc.MipLevels = 1;
+		desc.Format = DXGI_FORMAT_UNKNOWN;
+		desc.SampleDesc.Count = 1;
+		desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+		if (pD3DDevice->CreateCommittedResource(&props, D3D12_HEAP_FLAG_NONE, &desc,
+			D3D12_RESOURCE_STATE_GENERIC_READ, NULL, IID_PPV_ARGS(&buffer)) != S_OK)
+			return false;
+		// Upload heaps may stay mapped for their whole life
+		D3D12_RANGE range = { 0, 0 };
+		return buffer->Map(0, &range, (void**)&data) == S_OK;
+	}
+
+	static bool CreateUploader() {
+		D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+		queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+		queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+		if (pD3DDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&g_pCopyQueue)) != S_OK ||
+			pD3DDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&g_pCopyFence)) != S_OK)
+			return false;
+
+		CComPtr<ID3D12CommandAllocator> allocator;
+		if (pD3DDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&allocator)) != S_OK ||
+			pD3DDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, allocator, NULL, IID_PPV_ARGS(&g_pCopyList)) != S_OK ||
+			g_pCopyList->Close() != S_OK)
+			return false;
+		g_CopyAllocators.push_back({ allocator, 0 });
+
+		if (!CreateUploadBuffer(kUploadRingSize, g_pUploadRing, g_UploadRingData))
+			return false;
+		g_UploadRing.Reset(kUploadRingSize);
+		return true;
+	}
+
+	// Call with g_UploadMutex held
+	static bool OpenCopyList() {
+		if (g_CopyListOpen)
+			return true;
+		// The oldest allocator is free once its batch completed; otherwise another one joins the rotation
+		CComPtr<ID3D12CommandAllocator> allocator;
+		if (!g_CopyAllocators.empty() && g_CopyAllocators.front().fence <= g_pCopyFence->GetCompletedValue()) {
+			allocator = g_CopyAllocators.front().allocator;
+			g_CopyAllocators.pop_front();
+			allocator->Reset();
+		}
+		else if (pD3DDevice->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&allocator)) != S_OK) {
+			return false;
+		}
+		if (g_pCopyList->Reset(allocator, NULL) != S_OK)
+			return false;
+		g_CopyAllocators.push_back({ allocator, g_CopyFenceValue + 1 });
+		g_CopyListOpen = true;
+		return true;
+	}
+
+	// Room for `size` bytes of staging data in the open batch. Call with g_UploadMutex held.
+	static bool StageUpload(UINT64 size, ID3D12Resource*& buffer, UINT64& offset, unsigned char*& data) {
+		const UINT64 batch = g_CopyFenceValue + 1;
+		g_UploadRing.Retire(g_pCopyFence->GetCompletedValue());
+		offset = g_UploadRing.Allocate(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, batch);
+		if (offset != UploadRing::kFull) {
+			buffer = g_pUploadRing;
+			data = g_UploadRingData + offset;
+			return true;
+		}
+		// Bigger than the ring, or the ring is still busy with batches in flight
+		CComPtr<ID3D12Resource> oversize;
+		if (!CreateUploadBuffer(size, oversize, data))
+			return false;
+		buffer = oversize;
+		offset = 0;
+		g_OversizeUploads.push_back({ oversize, batch });
+		return true;
+	}
+
+	// Submits the copies recorded since the last call, ahead of the frame about to be executed
+	static void FlushUploads() {
+		std::lock_guard lock(g_UploadMutex);
+		if (!g_CopyListOpen)
+			return;
+		g_CopyListOpen = false;
+		if (g_pCopyList->Close() != S_OK)
+			return;
+		// A texture can't be copied into on one queue while another samples it
+		if (g_CopyTouchesLiveTextures)
+			g_pCopyQueue->Wait(g_pD3DFence, g_FenceValue);
+		g_CopyTouchesLiveTextures = false;
+		g_pCopyQueue->ExecuteCommandLists(1, (ID3D12CommandList**)&g_pCopyList.p);
+		g_pCopyQueue->Signal(g_pCopyFence, ++g_CopyFenceValue);
+		// The frame may sample what was just copied
+		g_pD3DCommandQueue->Wait(g_pCopyFence, g_CopyFenceValue);
+
+		const UINT64 completed = g_pCopyFence->GetCompletedValue();
+		std::erase_if(g_OversizeUploads, [&](const OversizeUpload& upload) { return upload.fence <= completed; });
+	}
+
+	static DXGI_FORMAT ToDxgi(TextureLoader::Format format)
 	{
-		// Load from disk into a raw RGBA buffer
-		int image_width = 0;
-		int image_height = 0;
-		unsigned char* image_data = stbi_load(filename, &image_width, &image_height, NULL, 4);
-		if (image_data == NULL)
+		switch (format) {
+		case TextureLoader::Format::BC1:	return DXGI_FORMAT_BC1_UNORM;
+		case TextureLoader::Format::BC3:	return DXGI_FORMAT_BC3_UNORM;
+		case TextureLoader::Format::BC7:	return DXGI_FORMAT_BC7_UNORM;
+		default:							return DXGI_FORMAT_R8G8B8A8_UNORM;
+		}
+	}
+
+	// Records a copy of `image` into `texture` at (x, y), one subresource per mip level. Regions
+	// (x, y != 0) are only written into the top level. Call with g_UploadMutex held.
+	static bool RecordCopy(ID3D12Resource* texture, UINT x, UINT y, const TextureLoader::Image& image)
+	{
+		constexpr UINT kMaxMips = D3D12_REQ_MIP_LEVELS;
+		if (image.mips < 1 || image.mips > (int)kMaxMips)
+			return false;
+		const UINT mips = (UINT)image.mips;
+
+		D3D12_RESOURCE_DESC desc = texture->GetDesc();
+		desc.Width = image.width;
+		desc.Height = image.height;
+		desc.MipLevels = (UINT16)mips;
+
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprints[kMaxMips];
+		UINT rows[kMaxMips];
+		UINT64 rowSizes[kMaxMips];
+		UINT64 uploadSize = 0;
+		pD3DDevice->GetCopyableFootprints(&desc, 0, mips, 0, footprints, rows, rowSizes, &uploadSize);
+
+		ID3D12Resource* buffer = NULL;
+		UINT64 offset = 0;
+		unsigned char* data = NULL;
+		if (!OpenCopyList() || !StageUpload(uploadSize, buffer, offset, data))
 			return false;
 
+		const unsigned char* src = image.Data();
+		for (UINT level = 0; level < mips; level++) {
+			const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint = footprints[level];
+
+			// Write pixels (or block rows) into the staging memory
+			const int width = TextureLoader::MipExtent(image.width, level);
+			const int height = TextureLoader::MipExtent(image.height, level);
+			const size_t srcPitch = TextureLoader::RowPitch(image.format, width);
+			for (UINT row = 0; row < rows[level]; row++)
+				memcpy(data + footprint.Offset + (size_t)row * footprint.Footprint.RowPitch, src + row * srcPitch, srcPitch);
+			src += TextureLoader::LevelSize(image.format, width, height);
+
+			// Copy the staging memory into the real resource
+			D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
+			srcLocation.pResource = buffer;
+			srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+			srcLocation.PlacedFootprint = footprint;
+			srcLocation.PlacedFootprint.Offset = offset + footprint.Offset;
+
+			D3D12_TEXTURE_COPY_LOCATION dstLocation = {};
+			dstLocation.pResource = texture;
+			dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+			dstLocation.SubresourceIndex = level;
+
+			g_pCopyList->CopyTextureRegion(&dstLocation, x, y, 0, &srcLocation, NULL);
+		}
+		return true;
+	}
+
+	// Creates the texture and records its upload into the open batch
+	static bool CreateTexture(const TextureLoader::Image& image, ID3D12Resource** out_tex_resource)
+	{
+		// Block-compressed resources need whole blocks in the top level
+		if (image.format != TextureLoader::Format::RGBA8 && (image.width % 4 != 0 || image.height % 4 != 0)) {
+			loader::LOG(loader::ERR) << "[LuaEngineUI] Compressed texture size " << image.width << "x" << image.height << " is not a multiple of 4";
+			return false;
+		}
+
 		// Create texture resource
 		D3D12_HEAP_PROPERTIES props;
 		memset(&props, 0, sizeof(D3D12_HEAP_PROPERTIES));
@@ -95,164 +387,282 @@ namespace D3D12 {
 		ZeroMemory(&desc, sizeof(desc));
 		desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
 		desc.Alignment = 0;
-		desc.Width = image_width;
-		desc.Height = image_height;
+		desc.Width = image.width;
+		desc.Height = image.height;
 		desc.DepthOrArraySize = 1;
-		desc.MipLevels = 1;
-		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.MipLevels = (UINT16)image.mips;
+		desc.Format = ToDxgi(image.format);
 		desc.SampleDesc.Count = 1;
 		desc.SampleDesc.Quality = 0;
 		desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 		desc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-		ID3D12Resource* pTexture = NULL;
-		d3d_device->CreateCommittedResource(&props, D3D12_HEAP_FLAG_NONE, &desc,
-			D3D12_RESOURCE_STATE_COPY_DEST, NULL, IID_PPV_ARGS(&pTexture));
+		// Created in COMMON: the copy queue promotes it to COPY_DEST, and after the copy it decays
+		// back, ready to be promoted to a shader resource by the frame that samples it
+		CComPtr<ID3D12Resource> texture;
+		if (pD3DDevice->CreateCommittedResource(&props, D3D12_HEAP_FLAG_NONE, &desc,
+			D3D12_RESOURCE_STATE_COMMON, NULL, IID_PPV_ARGS(&texture)) != S_OK)
+			return false;
 
-		// Create a temporary upload resource to move the data in
-		UINT uploadPitch = (image_width * 4 + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u) & ~(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u);
-		UINT uploadSize = image_height * uploadPitch;
-		desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-		desc.Alignment = 0;
-		desc.Width = uploadSize;
-		desc.Height = 1;
-		desc.DepthOrArraySize = 1;
-		desc.MipLevels = 1;
-		desc.Format = DXGI_FORMAT_UNKNOWN;
-		desc.SampleDesc.Count = 1;
-		desc.SampleDesc.Quality = 0;
-		desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-		desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+		std::lock_guard lock(g_UploadMutex);
+		if (!RecordCopy(texture, 0, 0, image))
+			return false;
 
-		props.Type = D3D12_HEAP_TYPE_UPLOAD;
-		props.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-		props.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+		// Return results
+		*out_tex_resource = texture.Detach();
+		return true;
+	}
 
-		ID3D12Resource* uploadBuffer = NULL;
-		HRESULT hr = d3d_device->CreateCommittedResource(&props, D3D12_HEAP_FLAG_NONE, &desc,
-			D3D12_RESOURCE_STATE_GENERIC_READ, NULL, IID_PPV_ARGS(&uploadBuffer));
-		IM_ASSERT(SUCCEEDED(hr));
-
-		// Write pixels into the upload resource
-		void* mapped = NULL;
-		D3D12_RANGE range = { 0, uploadSize };
-		hr = uploadBuffer->Map(0, &range, &mapped);
-		IM_ASSERT(SUCCEEDED(hr));
-		for (int y = 0; y < image_height; y++)
-			memcpy((void*)((uintptr_t)mapped + y * uploadPitch), image_data + y * image_width * 4, image_width * 4);
-		uploadBuffer->Unmap(0, &range);
-
-		// Copy the upload resource content into the real resource
-		D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
-		srcLocation.pResource = uploadBuffer;
-		srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-		srcLocation.PlacedFootprint.Footprint.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-		srcLocation.PlacedFootprint.Footprint.Width = image_width;
-		srcLocation.PlacedFootprint.Footprint.Height = image_height;
-		srcLocation.PlacedFootprint.Footprint.Depth = 1;
-		srcLocation.PlacedFootprint.Footprint.RowPitch = uploadPitch;
-
-		D3D12_TEXTURE_COPY_LOCATION dstLocation = {};
-		dstLocation.pResource = pTexture;
-		dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
-		dstLocation.SubresourceIndex = 0;
-
-		D3D12_RESOURCE_BARRIER barrier = {};
-		barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-		barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-		barrier.Transition.pResource = pTexture;
-		barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-		barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
-		barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-
-		// Create a temporary command queue to do the copy with
-		ID3D12Fence* fence = NULL;
-		hr = d3d_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
-		IM_ASSERT(SUCCEEDED(hr));
-
-		HANDLE event = CreateEvent(0, 0, 0, 0);
-		IM_ASSERT(event != NULL);
+	// A free SRV slot, growing the heaps when they are full. Call with g_SrvMutex held.
+	static uint32_t AllocateSrv()
+	{
+		uint32_t slot = g_SrvSlots.Allocate();
+		if (slot == Descriptors::kInvalid && GrowSrvHeaps(g_SrvSlots.Capacity() * 2))
+			slot = g_SrvSlots.Allocate();
+		return slot;
+	}
 
-		D3D12_COMMAND_QUEUE_DESC queueDesc = {};
-		queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
-		queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
-		queueDesc.NodeMask = 1;
+	// Creates a view of `texture` from `mip` down in `slot` and returns its ImTextureID. Call with
+	// g_SrvMutex held.
+	static uint64_t CreateView(ID3D12Resource* texture, uint32_t slot, UINT mip)
+	{
+		const D3D12_RESOURCE_DESC desc = texture->GetDesc();
+		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+		ZeroMemory(&srvDesc, sizeof(srvDesc));
+		srvDesc.Format = desc.Format;
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = desc.MipLevels - mip;
+		srvDesc.Texture2D.MostDetailedMip = mip;
+		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+		pD3DDevice->CreateShaderResourceView(texture, &srvDesc, SrvCpuHandle(g_pD3DSrvStagingHeap, slot));
+		pD3DDevice->CopyDescriptorsSimple(1, SrvCpuHandle(g_pD3DSrvDescHeap, slot), SrvCpuHandle(g_pD3DSrvStagingHeap, slot), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-		ID3D12CommandQueue* cmdQueue = NULL;
-		hr = d3d_device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&cmdQueue));
-		IM_ASSERT(SUCCEEDED(hr));
+		D3D12_GPU_DESCRIPTOR_HANDLE gpu = g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart();
+		gpu.ptr += (UINT64)g_SrvIncrement * slot;
+		return (uint64_t)(ImTextureID)gpu.ptr;
+	}
 
-		ID3D12CommandAllocator* cmdAlloc = NULL;
-		hr = d3d_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&cmdAlloc));
-		IM_ASSERT(SUCCEEDED(hr));
+	// TextureCache backend
+	static bool UploadTexture(const TextureLoader::Image& image, TextureCache::Texture& out)
+	{
+		// We need to pass a D3D12_GPU_DESCRIPTOR_HANDLE in ImTextureID, so make sure it will fit
+		static_assert(sizeof(ImTextureID) >= sizeof(D3D12_GPU_DESCRIPTOR_HANDLE), "D3D12_GPU_DESCRIPTOR_HANDLE is too large to fit in an ImTextureID");
 
-		ID3D12GraphicsCommandList* cmdList = NULL;
-		hr = d3d_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, cmdAlloc, NULL, IID_PPV_ARGS(&cmdList));
-		IM_ASSERT(SUCCEEDED(hr));
+		// One view for the whole chain, plus one starting at each lower level. The slots come first:
+		// once CreateTexture recorded its copy, the texture may only go through the fenced retire list.
+		std::vector<uint32_t> slots;
+		{
+			std::lock_guard lock(g_SrvMutex);
+			for (int level = 0; level < image.mips; level++) {
+				const uint32_t slot = AllocateSrv();
+				if (slot == Descriptors::kInvalid) {
+					loader::LOG(loader::ERR) << "[LuaEngineUI] No free SRV descriptor for a texture";
+					for (uint32_t allocated : slots)
+						g_SrvSlots.Free(allocated);
+					return false;
+				}
+				slots.push_back(slot);
+			}
+		}
 
-		cmdList->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, NULL);
-		cmdList->ResourceBarrier(1, &barrier);
+		// Nothing was recorded when this fails, and no view was written into the slots
+		ID3D12Resource* texture = NULL;
+		if (!CreateTexture(image, &texture)) {
+			std::lock_guard lock(g_SrvMutex);
+			for (uint32_t slot : slots)
+				g_SrvSlots.Free(slot);
+			return false;
+		}
 
-		hr = cmdList->Close();
-		IM_ASSERT(SUCCEEDED(hr));
+		std::lock_guard lock(g_SrvMutex);
+		out.id = CreateView(texture, slots[0], 0);
+		out.width = image.width;
+		out.height = image.height;
+		out.resource = texture;
+		out.descriptor = slots[0];
+		out.levels.clear();
+		for (UINT level = 1; level < slots.size(); level++)
+			out.levels.push_back({ CreateView(texture, slots[level], level), slots[level] });
+		return true;
+	}
 
-		// Execute the copy
-		cmdQueue->ExecuteCommandLists(1, (ID3D12CommandList* const*)&cmdList);
-		hr = cmdQueue->Signal(fence, 1);
-		IM_ASSERT(SUCCEEDED(hr));
+	static bool UpdateTexture(const TextureCache::Texture& texture, int x, int y, const TextureLoader::Image& region) {
+		std::lock_guard lock(g_UploadMutex);
+		if (!RecordCopy((ID3D12Resource*)texture.resource, x, y, region))
+			return false;
+		g_CopyTouchesLiveTextures = true;
+		return true;
+	}
 
-		// Wait for everything to complete
-		fence->SetEventOnCompletion(1, event);
-		WaitForSingleObject(event, INFINITE);
+	// BuildFrame calls so far. Draw data and dropped textures are tagged with the build they came
+	// from.
+	static uint64_t g_Builds = 0;
+
+	// Textures the cache dropped. Draw data from the build that dropped one, or an older build, may
+	// still show it, since UIRate repeats a frame. So each one is stamped with the next fence value only once a later build's draw data was presented, and
+	// released once the GPU passed that.
+	struct RetiredTexture {
+		CComPtr<ID3D12Resource> resource;
+		std::vector<uint32_t> descriptors;
+		uint64_t build;
+		UINT64 fence;
+	};
+	static std::mutex g_RetiredMutex;
+	static std::vector<RetiredTexture> g_Retired;
+
+	static void ReleaseTexture(const TextureCache::Texture& texture) {
+		CComPtr<ID3D12Resource> resource;
+		resource.Attach((ID3D12Resource*)texture.resource);
+		std::vector<uint32_t> descriptors{ texture.descriptor };
+		for (const TextureCache::Texture::Level& level : texture.levels)
+			descriptors.push_back(level.descriptor);
+		std::lock_guard lock(g_RetiredMutex);
+		g_Retired.push_back({ std::move(resource), std::move(descriptors), g_Builds, 0 });
+	}
 
-		// Tear down our temporary command queue and release the upload resource
-		cmdList->Release();
-		cmdAlloc->Release();
-		cmdQueue->Release();
-		CloseHandle(event);
-		fence->Release();
-		uploadBuffer->Release();
+	// Call after signalling a frame with the build its draw data came from, or with `all` once the
+	// GPU is idle
+	static void ReleaseRetired(bool all, uint64_t presented) {
+		std::lock_guard lock(g_RetiredMutex);
+		const UINT64 completed = all ? UINT64_MAX : g_pD3DFence->GetCompletedValue();
+		std::erase_if(g_Retired, [&](RetiredTexture& retired) {
+			if (retired.fence == 0 && !all) {
+				if (presented <= retired.build)
+					return false;
+				retired.fence = g_FenceValue;
+			}
+			if (retired.fence > completed)
+				return false;
+			// Nothing in flight reads the slot anymore
+			std::lock_guard srvLock(g_SrvMutex);
+			for (uint32_t descriptor : retired.descriptors)
+				g_SrvSlots.Free(descriptor);
+			return true;
+		});
+	}
 
-		// Create a shader resource view for the texture
-		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
-		ZeroMemory(&srvDesc, sizeof(srvDesc));
-		srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Texture2D.MipLevels = desc.MipLevels;
-		srvDesc.Texture2D.MostDetailedMip = 0;
-		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		d3d_device->CreateShaderResourceView(pTexture, &srvDesc, srv_cpu_handle);
+	static void WaitForFence(ID3D12Fence* fence, UINT64 value) {
+		if (fence->GetCompletedValue() >= value)
+			return;
+		fence->SetEventOnCompletion(value, g_FenceEvent);
+		WaitForSingleObject(g_FenceEvent, INFINITE);
+	}
 
-		// Return results
-		*out_tex_resource = pTexture;
-		*out_width = image_width;
-		*out_height = image_height;
-		stbi_image_free(image_data);
+	static void WaitForGpu() {
+		WaitForFence(g_pD3DFence, g_FenceValue);
+	}
+
+	// Buttons and keys that went down in the batch of messages being applied
+	static std::bitset<3 + 256> g_Pressed;
 
+	static bool Press(bool& down, size_t bit) {
+		down = true;
+		g_Pressed.set(bit);
 		return true;
 	}
 
-	static inline std::tuple<uintptr_t, int, int> LoadTexture(std::string file)
-	{
-		// We need to pass a D3D12_CPU_DESCRIPTOR_HANDLE in ImTextureID, so make sure it will fit
-		static_assert(sizeof(ImTextureID) >= sizeof(D3D12_CPU_DESCRIPTOR_HANDLE), "D3D12_CPU_DESCRIPTOR_HANDLE is too large to fit in an ImTextureID");
-		// We presume here that we have our D3D device pointer in pd3dDevice
-		int my_image_width = 0;
-		int my_image_height = 0;
-		ID3D12Resource* my_texture = NULL;
-		// Get CPU/GPU handles for the shader resource view
-		// Normally your engine will have some sort of allocator for these - here we assume that there's an SRV descriptor heap in
-		// g_pd3dSrvDescHeap with at least two descriptors allocated, and descriptor 1 is unused
-		UINT handle_increment = pD3DDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-		D3D12_CPU_DESCRIPTOR_HANDLE my_texture_srv_cpu_handle = g_pD3DSrvDescHeap->GetCPUDescriptorHandleForHeapStart();
-		my_texture_srv_cpu_handle.ptr += (handle_increment * descriptor_index);
-		D3D12_GPU_DESCRIPTOR_HANDLE my_texture_srv_gpu_handle = g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart();
-		my_texture_srv_gpu_handle.ptr += (handle_increment * descriptor_index);
-		descriptor_index += 1;
-		// Load the texture from a file
-		bool ret = LoadTextureFromFile(file.c_str(), pD3DDevice, my_texture_srv_cpu_handle, &my_texture, &my_image_width, &my_image_height);
-		IM_ASSERT(ret);
-		return std::make_tuple((uintptr_t)(ImTextureID)my_texture_srv_gpu_handle.ptr, my_image_width, my_image_height);
+	// A release of something that went down in the same batch waits for the next frame, so
+	// ImGui still sees a click that was shorter than a frame.
+	static bool Release(bool& down, size_t bit) {
+		if (g_Pressed.test(bit))
+			return false;
+		down = false;
+		return true;
+	}
+
+	// Feeds one mouse or keyboard message to ImGui. Returns false to keep it queued.
+	static bool ApplyInput(uint32_t msg, uint64_t wParam, int64_t lParam) {
+		ImGuiIO& io = ImGui::GetIO();
+		switch (msg) {
+		case WM_LBUTTONDOWN:
+			return Press(io.MouseDown[0], 0);
+		case WM_LBUTTONUP:
+			return Release(io.MouseDown[0], 0);
+		case WM_RBUTTONDOWN:
+			return Press(io.MouseDown[1], 1);
+		case WM_RBUTTONUP:
+			return Release(io.MouseDown[1], 1);
+		case WM_MBUTTONDOWN:
+			return Press(io.MouseDown[2], 2);
+		case WM_MBUTTONUP:
+			return Release(io.MouseDown[2], 2);
+		case WM_MOUSEWHEEL:
+			io.MouseWheel += GET_WHEEL_DELTA_WPARAM(wParam) > 0 ? +1.0f : -1.0f;
+			return true;
+		case WM_MOUSEMOVE:
+			io.MousePos.x = (signed short)(lParam);
+			io.MousePos.y = (signed short)(lParam >> 16);
+			return true;
+		case WM_KEYDOWN:
+			return wParam < 256 ? Press(io.KeysDown[wParam], 3 + wParam) : true;
+		case WM_KEYUP:
+			return wParam < 256 ? Release(io.KeysDown[wParam], 3 + wParam) : true;
+		case WM_CHAR:
+			// You can also use ToAscii()+GetKeyboardState() to retrieve characters.
+			if (wParam > 0 && wParam < 0x10000)
+				io.AddInputCharacter((unsigned short)wParam);
+			return true;
+		}
+		return true;
+	}
+
+	// One UI frame: queued input, NewFrame, the scripts, Render. Runs on the present thread only:
+	// the scripts' states are driven by LuaEngine.dll from the game thread, so they are never
+	// resumed from a thread of ours.
+	static ImDrawData* BuildFrame(uint64_t& build) {
+		build = ++g_Builds;
+		g_Pressed.reset();
+		InputQueue::Drain(ApplyInput);
+		ImGui_ImplWin32_NewFrame();
+		ImGui::NewFrame();
+
+		if (LuaCore::reloadTime != 0 && LuaCore::reload != LuaCore::reloadTime) {
+			LuaCore::reload = LuaCore::reloadTime;
+			LuaCore::initUI = false;
+			LuaUI::Invalidate();
+		}
+		if (!LuaCore::initUI)
+		{
+			// Only states that are new since the last pass get bound
+			const LuaUI::Changes& changes = LuaUI::Refresh();
+			RetainedUI::Forget(changes.removed);
+			FrameBudget::Forget(changes.removed);
+			GcPacer::Forget(changes.removed);
+			TextureCache::Forget(changes.removed);
+			LuaTasks::Sync(changes.live, changes.removed);
+			LuaProfiler::Sync(changes.live, changes.removed);
+			//imgui
+			LuaCore::Imgui_Bindings(changes.added);
+			//ȡ
+			for (lua_State* L : changes.added) {
+				sol::state_view lua(L);
+				TextureCache::Init(lua);
+				RetainedUI::Init(lua);
+				LuaProfiler::Init(lua);
+				ScriptProfiler::Init(lua);
+				FrameBudget::Init(lua);
+				GcPacer::Init(lua);
+				IdleSkip::Init(lua);
+				FrameReuse::Init(lua);
+				UIRate::Init(lua);
+				LuaTasks::Init(lua);
+			}
+		}
+		// Before the scripts run, so the age covers the lists this frame replays
+		TextureCache::Update(FrameBudget::ReplayAge());
+		LuaProfiler::BeginFrame();
+		LuaUI::Run();
+		RetainedUI::Render();
+		LuaTasks::Run();
+		LuaProfiler::EndFrame();
+		ScriptProfiler::DrawOverlay();
+
+		ImGui::Render();
+		const ImGuiIO& io = ImGui::GetIO();
+		InputQueue::PublishCapture(io.WantCaptureMouse, io.WantCaptureKeyboard);
+		ImDrawData* drawData = FrameBudget::Compose(ImGui::GetDrawData());
+		IdleSkip::Rendered(drawData);
+		return drawData;
 	}
 
 	long __fastcall HookPresent(IDXGISwapChain3* pSwapChain, UINT SyncInterval, UINT Flags) {
@@ -277,14 +687,12 @@ namespace D3D12 {
 			}
 
 			{
-				D3D12_DESCRIPTOR_HEAP_DESC desc = {};
-				desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-				desc.NumDescriptors = g_FrameBufferCount;
-				desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-
-				if (pD3DDevice->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&g_pD3DSrvDescHeap)) != S_OK) {
+				if (!CreateSrvHeap(kInitialSrvDescriptors, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, g_pD3DSrvDescHeap) ||
+					!CreateSrvHeap(kInitialSrvDescriptors, D3D12_DESCRIPTOR_HEAP_FLAG_NONE, g_pD3DSrvStagingHeap)) {
 					return OriginalPresent(pSwapChain, SyncInterval, Flags);
 				}
+				g_SrvIncrement = pD3DDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				g_SrvSlots.Reset(kInitialSrvDescriptors, 1);
 			}
 
 			{
@@ -323,7 +731,19 @@ namespace D3D12 {
 					}
 				}
 
-				if (pD3DDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, g_FrameContext[0].command_allocator, NULL, IID_PPV_ARGS(&g_pD3DCommandList)) != S_OK || g_pD3DCommandList->Close() != S_OK) {
+				for (size_t i = 0; i < g_FrameBufferCount; i++) {
+					ID3D12GraphicsCommandList*& list = g_FrameContext[i].command_list.p;
+					if (pD3DDevice->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, g_FrameContext[i].command_allocator, NULL, IID_PPV_ARGS(&list)) != S_OK || list->Close() != S_OK) {
+						return OriginalPresent(pSwapChain, SyncInterval, Flags);
+					}
+				}
+
+				if (pD3DDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&g_pD3DFence)) != S_OK) {
+					return OriginalPresent(pSwapChain, SyncInterval, Flags);
+				}
+				if (!g_FenceEvent)
+					g_FenceEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+				if (!CreateUploader()) {
 					return OriginalPresent(pSwapChain, SyncInterval, Flags);
 				}
 			}
@@ -348,61 +768,82 @@ namespace D3D12 {
 				fonts->GetGlyphRangesChineseFull()
 			);
 			ImGui_ImplWin32_Init(Window);
+			// The font SRV is written to the staging heap and copied over once the backend made it
 			ImGui_ImplDX12_Init(pD3DDevice, g_FrameBufferCount,
 				DXGI_FORMAT_R8G8B8A8_UNORM, g_pD3DSrvDescHeap,
-				g_pD3DSrvDescHeap->GetCPUDescriptorHandleForHeapStart(),
+				g_pD3DSrvStagingHeap->GetCPUDescriptorHandleForHeapStart(),
 				g_pD3DSrvDescHeap->GetGPUDescriptorHandleForHeapStart());
+			FrameReuse::Reset(g_FrameBufferCount, g_FrameBufferCount);
+			TextureCache::SetBackend(UploadTexture, UpdateTexture, ReleaseTexture);
+			sol_ImGui::ResolveTexture = TextureCache::Resolve;
 
 			g_Initialized = true;
 
 			pD3DDevice->Release();
 		}
 
-		ImGui_ImplWin32_NewFrame();
 		ImGui_ImplDX12_NewFrame();
-		ImGui::NewFrame();
+		if (!g_FontSrvCopied) {
+			std::lock_guard lock(g_SrvMutex);
+			pD3DDevice->CopyDescriptorsSimple(1, SrvCpuHandle(g_pD3DSrvDescHeap, 0), SrvCpuHandle(g_pD3DSrvStagingHeap, 0), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			g_FontSrvCopied = true;
+		}
 
-		if (LuaCore::reloadTime != 0 && LuaCore::reload != LuaCore::reloadTime) {
-			LuaCore::reload = LuaCore::reloadTime;
-			LuaCore::initUI = false;
+		// Nothing on screen and nothing happened: leave the frame to the game
+		// Tasks only resume, and decoded textures only upload, in frames that run
+		const bool wake = (LuaCore::reloadTime != 0 && LuaCore::reload != LuaCore::reloadTime)
+			|| LuaTasks::Pending() > 0 || TextureCache::Loading();
+		if (IdleSkip::ShouldSkip(wake)) {
+			// Game callbacks keep allocating, so the paced collectors still need their slices
+			GcPacer::Step(0);
+			return OriginalPresent(pSwapChain, SyncInterval, Flags);
 		}
-		if (!LuaCore::initUI)
-		{
-			//imgui
-			LuaCore::Imgui_Bindings();
-			//ȡ
-			for (std::string file_name : LuaCore::getLuaFils()) {
-				LuaCore::LuaScriptData luae = LuaCore::getLuas()[file_name];
-				if (luae.start) {
-					sol::state_view lua(luae.L);
-					lua.set_function("LoadTexture", LoadTexture);
-				}
-			}
+		// Between updates, the last frame's draw data is still intact since NewFrame was not called
+		ImDrawData* drawData;
+		if (g_LastDrawData && !UIRate::Due())
+			drawData = g_LastDrawData;
+		else
+			drawData = g_LastDrawData = BuildFrame(g_LastDrawBuild);
+		const uint64_t drawBuild = g_LastDrawBuild;
+
+		const UINT backBufferIndex = pSwapChain->GetCurrentBackBufferIndex();
+		FrameContext& currentFrameContext = g_FrameContext[backBufferIndex];
+		FlushUploads();
+		std::unique_lock srvLock(g_SrvMutex);
+		RebaseTextures(*drawData);
+		const uint64_t drawHash = FrameReuse::Hash(*drawData);
+		if (!FrameReuse::CanReuse(backBufferIndex, drawHash)) {
+			// After reused frames, the buffers the backend writes next may still be read by a list in flight
+			if (FrameReuse::MustDrain())
+				WaitForGpu();
+			currentFrameContext.command_allocator->Reset();
+
+			ID3D12GraphicsCommandList* commandList = currentFrameContext.command_list;
+			D3D12_RESOURCE_BARRIER barrier;
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+			barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+			barrier.Transition.pResource = currentFrameContext.main_render_target_resource;
+			barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+			barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
+			barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
+			commandList->Reset(currentFrameContext.command_allocator, nullptr);
+			commandList->ResourceBarrier(1, &barrier);
+			commandList->OMSetRenderTargets(1, &currentFrameContext.main_render_target_descriptor, FALSE, nullptr);
+			commandList->SetDescriptorHeaps(1, &g_pD3DSrvDescHeap);
+			ImGui_ImplDX12_RenderDrawData(drawData, commandList);
+			barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
+			barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
+			commandList->ResourceBarrier(1, &barrier);
+			commandList->Close();
+			FrameReuse::Recorded(backBufferIndex, drawHash);
 		}
-		LuaCore::run("on_imgui");
-
-		FrameContext& currentFrameContext = g_FrameContext[pSwapChain->GetCurrentBackBufferIndex()];
-		currentFrameContext.command_allocator->Reset();
-
-		D3D12_RESOURCE_BARRIER barrier;
-		barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-		barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-		barrier.Transition.pResource = currentFrameContext.main_render_target_resource;
-		barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-		barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-		barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-		g_pD3DCommandList->Reset(currentFrameContext.command_allocator, nullptr);
-		g_pD3DCommandList->ResourceBarrier(1, &barrier);
-		g_pD3DCommandList->OMSetRenderTargets(1, &currentFrameContext.main_render_target_descriptor, FALSE, nullptr);
-		g_pD3DCommandList->SetDescriptorHeaps(1, &g_pD3DSrvDescHeap);
-		ImGui::Render();
-		ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), g_pD3DCommandList);
-		barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-		barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-		g_pD3DCommandList->ResourceBarrier(1, &barrier);
-		g_pD3DCommandList->Close();
+		srvLock.unlock();
 
-		g_pD3DCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**)&g_pD3DCommandList);
+		g_pD3DCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList**)&currentFrameContext.command_list.p);
+		g_pD3DCommandQueue->Signal(g_pD3DFence, ++g_FenceValue);
+		ReleaseRetired(false, drawBuild);
+		// Collect in whatever the UI pass left of its budget, now that the GPU has work
+		GcPacer::Step(FrameBudget::Leftover());
 		return OriginalPresent(pSwapChain, SyncInterval, Flags);
 	}
 
@@ -415,17 +856,46 @@ namespace D3D12 {
 	}
 
 	void ResetState() {
+		// Decodes read files and the disk cache, so none may be running once the hooks are gone
+		TextureLoader::Stop();
+		g_LastDrawData = nullptr;
+		FrameBudget::Reset();
 		if (g_Initialized) {
 			g_Initialized = false;
 			ImGui_ImplWin32_Shutdown();
 			ImGui_ImplDX12_Shutdown();
 		}
+		// The SRV heap goes away with the textures' descriptors; the cache loads them again
+		if (g_pD3DFence)
+			WaitForGpu();
+		TextureCache::Reset();
+		ReleaseRetired(true, 0);
+		if (g_pCopyFence)
+			WaitForFence(g_pCopyFence, g_CopyFenceValue);
+		{
+			std::lock_guard lock(g_UploadMutex);
+			g_CopyAllocators.clear();
+			g_OversizeUploads.clear();
+			g_pCopyList = nullptr;
+			g_CopyListOpen = false;
+			g_CopyTouchesLiveTextures = false;
+			g_pUploadRing = nullptr;
+			g_UploadRingData = NULL;
+			g_pCopyFence = nullptr;
+			g_CopyFenceValue = 0;
+			g_pCopyQueue = nullptr;
+		}
+		g_OldSrvHeaps.clear();
+		g_OldSrvRanges.clear();
+		g_FontSrvCopied = false;
 		pD3DDevice = nullptr;
 		g_pD3DCommandQueue = nullptr;
 		g_FrameContext.clear();
-		g_pD3DCommandList = nullptr;
+		g_pD3DFence = nullptr;
+		g_FenceValue = 0;
 		g_pD3DRtvDescHeap = nullptr;
 		g_pD3DSrvDescHeap = nullptr;
+		g_pD3DSrvStagingHeap = nullptr;
 	}
 
 	long HookResizeBuffers(IDXGISwapChain3* pSwapChain, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat, UINT SwapChainFlags) {
@@ -605,49 +1075,41 @@ namespace D3D12 {
 		return Status::Success;
 	}
 
+	enum class InputKind {
+		None,
+		Mouse,
+		Keyboard,
+	};
+
+	// Which capture flag decides whether the game still gets a message
+	static InputKind GetInputKind(UINT msg) {
+		switch (msg) {
+		case WM_LBUTTONDOWN:
+		case WM_LBUTTONUP:
+		case WM_RBUTTONDOWN:
+		case WM_RBUTTONUP:
+		case WM_MBUTTONDOWN:
+		case WM_MBUTTONUP:
+		case WM_MOUSEWHEEL:
+		case WM_MOUSEMOVE:
+			return InputKind::Mouse;
+		case WM_KEYDOWN:
+		case WM_KEYUP:
+		case WM_CHAR:
+			return InputKind::Keyboard;
+		default:
+			return InputKind::None;
+		}
+	}
+
 	LRESULT APIENTRY WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
-		if (g_Initialized) {
-			ImGuiIO& io = ImGui::GetIO();
-			switch (msg) {
-			case WM_LBUTTONDOWN:
-				io.MouseDown[0] = true;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_LBUTTONUP:
-				io.MouseDown[0] = false;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_RBUTTONDOWN:
-				io.MouseDown[1] = true;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_RBUTTONUP:
-				io.MouseDown[1] = false;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_MBUTTONDOWN:
-				io.MouseDown[2] = true;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_MBUTTONUP:
-				io.MouseDown[2] = false;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_MOUSEWHEEL:
-				io.MouseWheel += GET_WHEEL_DELTA_WPARAM(wParam) > 0 ? +1.0f : -1.0f;
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_MOUSEMOVE:
-				io.MousePos.x = (signed short)(lParam);
-				io.MousePos.y = (signed short)(lParam >> 16);
-				return io.WantCaptureMouse ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_KEYDOWN:
-				if (wParam < 256)
-					io.KeysDown[wParam] = 1;
-				return io.WantCaptureKeyboard ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_KEYUP:
-				if (wParam < 256)
-					io.KeysDown[wParam] = 0;
-				return io.WantCaptureKeyboard ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			case WM_CHAR:
-				// You can also use ToAscii()+GetKeyboardState() to retrieve characters.
-				if (wParam > 0 && wParam < 0x10000)
-					io.AddInputCharacter((unsigned short)wParam);
-				return io.WantCaptureKeyboard ? 0 : CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
-			}
+		const InputKind kind = GetInputKind(msg);
+		if (g_Initialized && kind != InputKind::None) {
+			IdleSkip::NotifyInput();
+			// Applied right before the next NewFrame
+			InputQueue::Push(msg, wParam, lParam);
+			if (kind == InputKind::Mouse ? InputQueue::WantCaptureMouse() : InputQueue::WantCaptureKeyboard())
+				return 0;
 		}
 		return CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
 	}
@@ -0,0 +1,130 @@
+#include "Dds.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace Dds {
+
+	constexpr uint32_t FourCC(char a, char b, char c, char d) {
+		return uint32_t(uint8_t(a)) | uint32_t(uint8_t(b)) << 8 | uint32_t(uint8_t(c)) << 16 | uint32_t(uint8_t(d)) << 24;
+	}
+
+	constexpr uint32_t kMagic = FourCC('D', 'D', 'S', ' ');
+	constexpr size_t kHeaderSize = 124;
+	constexpr size_t kHeaderDx10Size = 20;
+	// Larger than any texture the renderer will create
+	constexpr uint32_t kMaxExtent = 16384;
+	constexpr uint32_t kMaxMips = 15;
+
+	// Header field offsets, counted from after the magic
+	constexpr size_t kHeight = 8;
+	constexpr size_t kWidth = 12;
+	constexpr size_t kDepth = 20;
+	constexpr size_t kMipMapCount = 24;
+	constexpr size_t kPfFlags = 76;
+	constexpr size_t kPfFourCC = 80;
+	constexpr size_t kPfBitCount = 84;
+	constexpr size_t kPfMasks = 88;
+	constexpr size_t kCaps2 = 108;
+
+	constexpr uint32_t DDPF_FOURCC = 0x4;
+	constexpr uint32_t DDPF_RGB = 0x40;
+	constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+	constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+	constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+	// DXGI_FORMAT values from the DX10 header; the sRGB variants are sampled as UNORM like the rest
+	// of the UI textures
+	enum : uint32_t {
+		DXGI_R8G8B8A8_UNORM = 28,
+		DXGI_R8G8B8A8_UNORM_SRGB = 29,
+		DXGI_BC1_UNORM = 71,
+		DXGI_BC1_UNORM_SRGB = 72,
+		DXGI_BC3_UNORM = 77,
+		DXGI_BC3_UNORM_SRGB = 78,
+		DXGI_BC7_UNORM = 98,
+		DXGI_BC7_UNORM_SRGB = 99,
+	};
+
+	// Little-endian regardless of the host
+	static uint32_t Read32(const unsigned char* p) {
+		return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+	}
+
+	static bool FromDxgi(uint32_t format, TextureLoader::Format& out) {
+		switch (format) {
+		case DXGI_R8G8B8A8_UNORM:
+		case DXGI_R8G8B8A8_UNORM_SRGB:	out = TextureLoader::Format::RGBA8; return true;
+		case DXGI_BC1_UNORM:
+		case DXGI_BC1_UNORM_SRGB:		out = TextureLoader::Format::BC1; return true;
+		case DXGI_BC3_UNORM:
+		case DXGI_BC3_UNORM_SRGB:		out = TextureLoader::Format::BC3; return true;
+		case DXGI_BC7_UNORM:
+		case DXGI_BC7_UNORM_SRGB:		out = TextureLoader::Format::BC7; return true;
+		default:						return false;
+		}
+	}
+
+	bool Parse(const unsigned char* data, size_t size, TextureLoader::Image& out) {
+		if (size < 4 + kHeaderSize || Read32(data) != kMagic)
+			return false;
+		const unsigned char* header = data + 4;
+		if (Read32(header) != kHeaderSize)
+			return false;
+		size_t offset = 4 + kHeaderSize;
+
+		const uint32_t width = Read32(header + kWidth);
+		const uint32_t height = Read32(header + kHeight);
+		const uint32_t mips = Read32(header + kMipMapCount);
+		const uint32_t pfFlags = Read32(header + kPfFlags);
+		if (width == 0 || height == 0 || width > kMaxExtent || height > kMaxExtent || mips > kMaxMips)
+			return false;
+		if (Read32(header + kCaps2) & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+			return false;
+
+		TextureLoader::Format format;
+		if (pfFlags & DDPF_FOURCC) {
+			const uint32_t fourCC = Read32(header + kPfFourCC);
+			if (fourCC == FourCC('D', 'X', 'T', '1'))
+				format = TextureLoader::Format::BC1;
+			else if (fourCC == FourCC('D', 'X', 'T', '5'))
+				format = TextureLoader::Format::BC3;
+			else if (fourCC == FourCC('D', 'X', '1', '0')) {
+				if (size < offset + kHeaderDx10Size)
+					return false;
+				const unsigned char* dx10 = data + offset;
+				// dxgiFormat, resourceDimension, miscFlag, arraySize
+				if (!FromDxgi(Read32(dx10), format) || Read32(dx10 + 4) != DDS_DIMENSION_TEXTURE2D || Read32(dx10 + 12) > 1)
+					return false;
+				offset += kHeaderDx10Size;
+			}
+			else
+				return false;
+		}
+		else if ((pfFlags & DDPF_RGB) && Read32(header + kPfBitCount) == 32
+			&& Read32(header + kPfMasks) == 0x000000ff && Read32(header + kPfMasks + 4) == 0x0000ff00
+			&& Read32(header + kPfMasks + 8) == 0x00ff0000) {
+			format = TextureLoader::Format::RGBA8;
+		}
+		else
+			return false;
+		if (Read32(header + kDepth) > 1)
+			return false;
+
+		out.format = format;
+		out.width = static_cast<int>(width);
+		out.height = static_cast<int>(height);
+		out.mips = mips == 0 ? 1 : static_cast<int>(mips);
+		if ((std::max(width, height) >> (out.mips - 1)) == 0)
+			return false;
+
+		size_t total = 0;
+		for (int level = 0; level < out.mips; level++)
+			total += TextureLoader::LevelSize(format, TextureLoader::MipExtent(out.width, level), TextureLoader::MipExtent(out.height, level));
+		if (size - offset < total)
+			return false;
+		out.pixels.assign(data + offset, data + offset + total);
+		return true;
+	}
+
+}
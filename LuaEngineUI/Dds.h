@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+#include "TextureLoader.h"
+
+// DirectDraw Surface parsing for pre-compressed textures. Only plain 2D textures are accepted:
+// BC1 (DXT1), BC3 (DXT5) and BC7 through the DX10 header, plus uncompressed 32-bit RGBA. The
+// blocks are copied as they are, mips included, so the GPU samples them without a decode.
+namespace Dds {
+
+	// Fills `out` from a whole .dds file in memory; false for anything malformed or unsupported.
+	bool Parse(const unsigned char* data, size_t size, TextureLoader::Image& out);
+
+}
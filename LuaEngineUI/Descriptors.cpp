@@ -0,0 +1,41 @@
+#include "Descriptors.h"
+#include <algorithm>
+
+namespace Descriptors {
+
+	void Allocator::Reset(uint32_t capacity, uint32_t reserved) {
+		free.clear();
+		next = reserved;
+		this->capacity = capacity;
+		this->reserved = reserved;
+	}
+
+	uint32_t Allocator::Allocate() {
+		if (!free.empty()) {
+			const uint32_t slot = free.back();
+			free.pop_back();
+			return slot;
+		}
+		if (next >= capacity)
+			return kInvalid;
+		return next++;
+	}
+
+	void Allocator::Free(uint32_t slot) {
+		if (slot >= reserved && slot < next)
+			free.push_back(slot);
+	}
+
+	void Allocator::Grow(uint32_t capacity) {
+		this->capacity = std::max(this->capacity, capacity);
+	}
+
+	uint32_t Allocator::Capacity() const {
+		return capacity;
+	}
+
+	uint32_t Allocator::Used() const {
+		return next - reserved - static_cast<uint32_t>(free.size());
+	}
+
+}
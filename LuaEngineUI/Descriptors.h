@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Slot bookkeeping for descriptor heaps. It deals in indices only; the renderer owns the heaps,
+// so the same allocator serves any backend. When Allocate runs dry the renderer reallocates its
+// heaps with more room and reports the new size through Grow.
+namespace Descriptors {
+
+	constexpr uint32_t kInvalid = UINT32_MAX;
+
+	struct Allocator {
+		// Slots below `reserved` are never handed out.
+		void Reset(uint32_t capacity, uint32_t reserved);
+		// A free slot, or kInvalid when the heap is full.
+		uint32_t Allocate();
+		// The slot may be handed out again right away, so only free it once the GPU is done with it.
+		void Free(uint32_t slot);
+		void Grow(uint32_t capacity);
+
+		uint32_t Capacity() const;
+		uint32_t Used() const;
+
+	private:
+		// Freed slots, reused last-in first-out
+		std::vector<uint32_t> free;
+		// Slots at and past this one were never handed out
+		uint32_t next = 0;
+		uint32_t capacity = 0;
+		uint32_t reserved = 0;
+	};
+
+}
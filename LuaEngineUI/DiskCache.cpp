@@ -0,0 +1,264 @@
+#include "DiskCache.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DiskCache {
+
+	namespace fs = std::filesystem;
+
+	constexpr uint32_t kMagic = 0x4358544c;	// "LTXC"
+	constexpr size_t kHeaderSize = 64;
+	constexpr int kMaxExtent = 16384;
+
+	// Header fields by byte offset
+	constexpr size_t kOffMagic = 0;
+	constexpr size_t kOffVersion = 4;
+	constexpr size_t kOffKey = 8;
+	constexpr size_t kOffFormat = 16;
+	constexpr size_t kOffWidth = 20;
+	constexpr size_t kOffHeight = 24;
+	constexpr size_t kOffMips = 28;
+	constexpr size_t kOffBytes = 32;
+
+	// A temporary this old belongs to a write that is never going to finish
+	constexpr auto kTempAge = std::chrono::hours(1);
+	// Hits move an entry's write time forward, which sweeps go by, at most this often
+	constexpr auto kTouchAge = std::chrono::hours(24);
+
+	struct Layout {
+		uint64_t key;
+		TextureLoader::Format format;
+		int width;
+		int height;
+		int mips;
+		size_t bytes;
+	};
+
+	static std::mutex g_Mutex;
+	static std::string g_Directory;
+	static uint64_t g_MaxBytes = 0;
+	// Directory the first write of this run has swept
+	static std::string g_Swept;
+	static std::atomic<uint64_t> g_Hits{ 0 };
+	static std::atomic<uint64_t> g_Misses{ 0 };
+	static std::atomic<uint64_t> g_Writes{ 0 };
+	static std::atomic<uint64_t> g_Removed{ 0 };
+
+	static void Put32(unsigned char* p, uint32_t v) {
+		for (int i = 0; i < 4; i++)
+			p[i] = static_cast<unsigned char>(v >> (i * 8));
+	}
+
+	static void Put64(unsigned char* p, uint64_t v) {
+		for (int i = 0; i < 8; i++)
+			p[i] = static_cast<unsigned char>(v >> (i * 8));
+	}
+
+	static uint32_t Get32(const unsigned char* p) {
+		return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+	}
+
+	static uint64_t Get64(const unsigned char* p) {
+		return uint64_t(Get32(p)) | uint64_t(Get32(p + 4)) << 32;
+	}
+
+	static size_t Bytes(TextureLoader::Format format, int width, int height, int mips) {
+		size_t total = 0;
+		for (int level = 0; level < mips; level++)
+			total += TextureLoader::LevelSize(format, TextureLoader::MipExtent(width, level), TextureLoader::MipExtent(height, level));
+		return total;
+	}
+
+	std::string Path(const std::string& directory, uint64_t key) {
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.ltx", static_cast<unsigned long long>(key));
+		return (fs::path(directory) / name).string();
+	}
+
+	// Whether a header of this version describes an entry the file holds all of
+	static bool Check(const unsigned char* header, uint64_t fileSize, Layout& out) {
+		if (Get32(header + kOffMagic) != kMagic || Get32(header + kOffVersion) != kVersion)
+			return false;
+		const uint32_t format = Get32(header + kOffFormat);
+		out.key = Get64(header + kOffKey);
+		out.width = static_cast<int>(Get32(header + kOffWidth));
+		out.height = static_cast<int>(Get32(header + kOffHeight));
+		out.mips = static_cast<int>(Get32(header + kOffMips));
+		if (format > static_cast<uint32_t>(TextureLoader::Format::BC7) || out.width <= 0 || out.height <= 0
+			|| out.width > kMaxExtent || out.height > kMaxExtent || out.mips <= 0 || out.mips > 15)
+			return false;
+		out.format = static_cast<TextureLoader::Format>(format);
+		out.bytes = Bytes(out.format, out.width, out.height, out.mips);
+		return Get64(header + kOffBytes) == out.bytes && fileSize - kHeaderSize >= out.bytes;
+	}
+
+	static void Tidy(const std::string& directory) {
+		uint64_t maxBytes;
+		{
+			std::lock_guard lock(g_Mutex);
+			if (g_Swept == directory)
+				return;
+			g_Swept = directory;
+			maxBytes = g_MaxBytes;
+		}
+		Sweep(directory, maxBytes);
+	}
+
+	bool Write(const std::string& file, uint64_t key, const TextureLoader::Image& image) {
+		const size_t bytes = Bytes(image.format, image.width, image.height, image.mips);
+		unsigned char header[kHeaderSize] = {};
+		Put32(header + kOffMagic, kMagic);
+		Put32(header + kOffVersion, kVersion);
+		Put64(header + kOffKey, key);
+		Put32(header + kOffFormat, static_cast<uint32_t>(image.format));
+		Put32(header + kOffWidth, static_cast<uint32_t>(image.width));
+		Put32(header + kOffHeight, static_cast<uint32_t>(image.height));
+		Put32(header + kOffMips, static_cast<uint32_t>(image.mips));
+		Put64(header + kOffBytes, bytes);
+
+		// Several workers may write the same entry; each uses a name of its own
+		const std::string temp = file + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+		std::error_code ec;
+		fs::create_directories(fs::path(file).parent_path(), ec);
+		Tidy(fs::path(file).parent_path().string());
+		{
+			std::ofstream out(fs::path(temp), std::ios::binary | std::ios::trunc);
+			if (!out)
+				return false;
+			out.write(reinterpret_cast<const char*>(header), kHeaderSize);
+			out.write(reinterpret_cast<const char*>(image.Data()), bytes);
+			if (!out) {
+				out.close();
+				fs::remove(temp, ec);
+				return false;
+			}
+		}
+		fs::rename(temp, file, ec);
+		if (ec) {
+			fs::remove(temp, ec);
+			return false;
+		}
+		g_Writes++;
+		return true;
+	}
+
+	static bool Map(const std::string& file, uint64_t key, TextureLoader::Image& out) {
+		auto mapping = std::make_shared<FileMap::Mapping>();
+		if (!mapping->Open(file) || mapping->Size() < kHeaderSize)
+			return false;
+		const unsigned char* header = mapping->Data();
+		Layout layout;
+		if (!Check(header, mapping->Size(), layout) || layout.key != key)
+			return false;
+
+		out.format = layout.format;
+		out.width = layout.width;
+		out.height = layout.height;
+		out.mips = layout.mips;
+		out.pixels.clear();
+		out.mapped = header + kHeaderSize;
+		out.mapping = std::move(mapping);
+		return true;
+	}
+
+	bool Read(const std::string& file, uint64_t key, TextureLoader::Image& out) {
+		const bool hit = Map(file, key, out);
+		(hit ? g_Hits : g_Misses)++;
+		if (hit) {
+			std::error_code ec;
+			const auto now = fs::file_time_type::clock::now();
+			const fs::file_time_type time = fs::last_write_time(file, ec);
+			if (!ec && now - time > kTouchAge)
+				fs::last_write_time(file, now, ec);
+		}
+		return hit;
+	}
+
+	// An entry file Read could hit: current version, whole, and named after the key inside
+	static bool Readable(const fs::path& file, uint64_t size) {
+		unsigned char header[kHeaderSize];
+		std::ifstream in(file, std::ios::binary);
+		if (size < kHeaderSize || !in.read(reinterpret_cast<char*>(header), kHeaderSize))
+			return false;
+		Layout layout;
+		return Check(header, size, layout) && fs::path(Path("", layout.key)) == file.filename();
+	}
+
+	size_t Sweep(const std::string& directory, uint64_t maxBytes) {
+		struct Kept {
+			fs::path path;
+			uint64_t size;
+			fs::file_time_type time;
+		};
+		std::vector<Kept> kept;
+		std::vector<fs::path> doomed;
+		uint64_t total = 0;
+		const auto now = fs::file_time_type::clock::now();
+
+		std::error_code ec;
+		for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+			std::error_code fileEc;
+			const fs::path& path = it->path();
+			const std::string name = path.filename().string();
+			const bool entry = path.extension() == ".ltx";
+			// Write's temporaries are named after the entry, "<key>.ltx.<thread>.tmp"
+			const bool temp = path.extension() == ".tmp" && name.find(".ltx.") != std::string::npos;
+			if ((!entry && !temp) || !it->is_regular_file(fileEc))
+				continue;
+			const uint64_t size = it->file_size(fileEc);
+			const fs::file_time_type time = it->last_write_time(fileEc);
+			if (fileEc)
+				continue;
+			if (temp ? now - time > kTempAge : !Readable(path, size))
+				doomed.push_back(path);
+			else if (entry) {
+				kept.push_back({ path, size, time });
+				total += size;
+			}
+		}
+
+		// Least recently used first
+		if (maxBytes > 0 && total > maxBytes) {
+			std::sort(kept.begin(), kept.end(), [](const Kept& a, const Kept& b) { return a.time < b.time; });
+			for (const Kept& entry : kept) {
+				if (total <= maxBytes)
+					break;
+				doomed.push_back(entry.path);
+				total -= entry.size;
+			}
+		}
+
+		size_t removed = 0;
+		for (const fs::path& path : doomed)
+			removed += fs::remove(path, ec);
+		g_Removed += removed;
+		return removed;
+	}
+
+	void SetDirectory(const std::string& directory, uint64_t maxBytes) {
+		std::lock_guard lock(g_Mutex);
+		// A new cap gets a sweep of its own
+		if (directory != g_Directory || maxBytes != g_MaxBytes)
+			g_Swept.clear();
+		g_Directory = directory;
+		g_MaxBytes = maxBytes;
+	}
+
+	std::string Directory() {
+		std::lock_guard lock(g_Mutex);
+		return g_Directory;
+	}
+
+	Stats GetStats() {
+		return { g_Hits.load(), g_Misses.load(), g_Writes.load(), g_Removed.load() };
+	}
+
+}
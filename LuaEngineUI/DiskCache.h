@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "TextureLoader.h"
+
+// Decoded images kept on disk between runs, so startup doesn't decode every PNG again. An entry is
+// keyed by a hash of the source file's bytes (and how it was loaded) and stored as one file: a
+// fixed 64-byte little-endian header followed by the levels exactly as TextureLoader::Image lays
+// them out, so a hit maps the file and uploads from it without a copy. Entries are written to a
+// temporary name and renamed into place; a torn or foreign file is simply a miss. The first write
+// into a directory in a run sweeps it: entries of other versions, torn entries and temporaries
+// left by a crash go, then the least recently used entries until the rest fits the size cap.
+namespace DiskCache {
+
+	// Bumped whenever the layout or the decoding behind it changes
+	constexpr uint32_t kVersion = 1;
+
+	// Entry file for `key` in `directory`
+	std::string Path(const std::string& directory, uint64_t key);
+
+	bool Write(const std::string& file, uint64_t key, const TextureLoader::Image& image);
+	// The image borrows the file's mapping on success. Counts a hit or a miss.
+	bool Read(const std::string& file, uint64_t key, TextureLoader::Image& out);
+
+	// Removes what a later Read could never hit, then the least recently used entries until the
+	// rest of the directory's entries fit in `maxBytes` (0 for no cap). Only touches .ltx files and
+	// our own temporaries, so the directory may be shared. Returns the number of files removed.
+	size_t Sweep(const std::string& directory, uint64_t maxBytes);
+
+	// Where entries go; empty (the default) turns the cache off. Safe to call from any thread.
+	void SetDirectory(const std::string& directory, uint64_t maxBytes);
+	std::string Directory();
+
+	struct Stats {
+		uint64_t hits;
+		uint64_t misses;
+		uint64_t writes;
+		// By sweeps
+		uint64_t removed;
+	};
+	Stats GetStats();
+
+}
@@ -0,0 +1,33 @@
+#include "DrawSnapshot.h"
+#include <cstring>
+
+namespace DrawSnapshot {
+
+	void CopyDrawList(ImDrawList& dst, const ImDrawList& src) {
+		dst.CmdBuffer.resize(src.CmdBuffer.Size);
+		dst.IdxBuffer.resize(src.IdxBuffer.Size);
+		dst.VtxBuffer.resize(src.VtxBuffer.Size);
+		if (src.CmdBuffer.Size)
+			memcpy(dst.CmdBuffer.Data, src.CmdBuffer.Data, src.CmdBuffer.size_in_bytes());
+		if (src.IdxBuffer.Size)
+			memcpy(dst.IdxBuffer.Data, src.IdxBuffer.Data, src.IdxBuffer.size_in_bytes());
+		if (src.VtxBuffer.Size)
+			memcpy(dst.VtxBuffer.Data, src.VtxBuffer.Data, src.VtxBuffer.size_in_bytes());
+		dst.Flags = src.Flags;
+	}
+
+	void Copy(Snapshot& dst, const ImDrawData& src) {
+		// Copies are never drawn into, so they need no shared data
+		while (dst.owned.size() < static_cast<size_t>(src.CmdListsCount))
+			dst.owned.push_back(std::make_unique<ImDrawList>(nullptr));
+		dst.lists.resize(src.CmdListsCount);
+		for (int i = 0; i < src.CmdListsCount; i++) {
+			CopyDrawList(*dst.owned[i], *src.CmdLists[i]);
+			dst.lists[i] = dst.owned[i].get();
+		}
+		dst.data = src;
+		dst.data.CmdLists = dst.lists.Data;
+		dst.data.OwnerViewport = nullptr;
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <imgui.h>
+
+// Deep copies of ImDrawData that outlive the next NewFrame. Nothing here touches the ImGui
+// context, so it works without a renderer.
+namespace DrawSnapshot {
+
+	// Copies the buffers the renderer reads, keeping dst's allocations.
+	void CopyDrawList(ImDrawList& dst, const ImDrawList& src);
+
+	// Draw data that owns its lists. `data` points into `lists` and stays valid until the next Copy.
+	struct Snapshot {
+		ImDrawData data;
+		ImVector<ImDrawList*> lists;
+		std::vector<std::unique_ptr<ImDrawList>> owned;
+	};
+
+	void Copy(Snapshot& dst, const ImDrawData& src);
+
+}
@@ -0,0 +1,110 @@
+#include "FileMap.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FileMap {
+
+	// The view stays valid after the handles are closed
+	static const unsigned char* Map(const std::string& path, size_t& size) {
+#ifdef _WIN32
+		HANDLE file = CreateFileW(std::filesystem::path(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+			NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return nullptr;
+		LARGE_INTEGER length;
+		const unsigned char* view = nullptr;
+		if (GetFileSizeEx(file, &length) && length.QuadPart > 0 && static_cast<unsigned long long>(length.QuadPart) <= SIZE_MAX) {
+			HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping != NULL) {
+				view = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				CloseHandle(mapping);
+			}
+			size = static_cast<size_t>(length.QuadPart);
+		}
+		CloseHandle(file);
+		return view;
+#else
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file < 0)
+			return nullptr;
+		struct stat info;
+		void* view = MAP_FAILED;
+		if (fstat(file, &info) == 0 && info.st_size > 0) {
+			size = static_cast<size_t>(info.st_size);
+			view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+		}
+		close(file);
+		return view == MAP_FAILED ? nullptr : static_cast<const unsigned char*>(view);
+#endif
+	}
+
+	static void Unmap(const unsigned char* data, size_t size) {
+#ifdef _WIN32
+		(void)size;
+		UnmapViewOfFile(data);
+#else
+		munmap(const_cast<unsigned char*>(data), size);
+#endif
+	}
+
+	Mapping::~Mapping() {
+		Close();
+	}
+
+	bool Mapping::Open(const std::string& path) {
+		Close();
+		size_t length = 0;
+		if (const unsigned char* view = Map(path, length)) {
+			data = view;
+			size = length;
+			mapped = true;
+			return true;
+		}
+
+		// Not mappable (e.g. some network shares): one read of the whole file
+		std::ifstream file(std::filesystem::path(path), std::ios::binary | std::ios::ate);
+		if (!file)
+			return false;
+		const std::streamoff end = file.tellg();
+		if (end <= 0)
+			return false;
+		buffer.resize(static_cast<size_t>(end));
+		file.seekg(0);
+		if (!file.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+			buffer.clear();
+			return false;
+		}
+		data = buffer.data();
+		size = buffer.size();
+		return true;
+	}
+
+	void Mapping::Close() {
+		if (mapped)
+			Unmap(data, size);
+		data = nullptr;
+		size = 0;
+		mapped = false;
+		buffer.clear();
+		buffer.shrink_to_fit();
+	}
+
+	const unsigned char* Mapping::Data() const {
+		return data;
+	}
+
+	size_t Mapping::Size() const {
+		return size;
+	}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Whole-file reads without stdio. A file is mapped into memory, so the decoder pulls it in through
+// the page cache instead of many small buffered reads; where mapping fails it is read in one go.
+namespace FileMap {
+
+	struct Mapping {
+		Mapping() = default;
+		~Mapping();
+		Mapping(const Mapping&) = delete;
+		Mapping& operator=(const Mapping&) = delete;
+
+		// Replaces what was open before. Empty files fail.
+		bool Open(const std::string& path);
+		void Close();
+
+		const unsigned char* Data() const;
+		size_t Size() const;
+
+	private:
+		const unsigned char* data = nullptr;
+		size_t size = 0;
+		// Set while `data` is a mapped view rather than `buffer`
+		bool mapped = false;
+		std::vector<unsigned char> buffer;
+	};
+
+}
@@ -0,0 +1,279 @@
+#include "FrameBudget.h"
+#include <imgui_internal.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "DrawSnapshot.h"
+
+namespace FrameBudget {
+
+	using Clock = std::chrono::steady_clock;
+
+	constexpr int kMaxTier = 8;
+	// Frames between two tier changes, so a single spike does not demote anyone
+	constexpr int kCooldown = 30;
+	// Promote only if the result stays this far under the budget
+	constexpr double kHeadroom = 0.75;
+	// Scripts cheaper than this are never worth throttling
+	constexpr double kMinCost = 0.05;
+
+	struct Entry {
+		lua_State* L;
+		int tier = 1;
+		int every = 1;
+		double rate = 0;
+		int priority = 0;
+		double cost = 0;
+		uint64_t lastFrame = 0;
+		Clock::time_point lastRun;
+		bool ran = false;
+		std::vector<ImGuiWindow*> windows;
+		std::vector<std::unique_ptr<ImDrawList>> replay;
+		int replayCount = 0;
+	};
+
+	static double g_BudgetMs = 4.0;
+	static std::vector<Entry> g_Entries;
+	static uint64_t g_Frame = 0;
+	static double g_SpentMs = 0;
+	static Clock::time_point g_Now;
+	static int g_Cooldown = 0;
+	static std::vector<ImGuiWindow*> g_Claimed;
+	static ImVector<ImDrawList*> g_Lists;
+	static ImDrawData g_Composed;
+
+	static Entry* Find(lua_State* L) {
+		for (Entry& entry : g_Entries) {
+			if (entry.L == L)
+				return &entry;
+		}
+		return nullptr;
+	}
+
+	static Entry& Get(lua_State* L) {
+		if (Entry* entry = Find(L))
+			return *entry;
+		g_Entries.push_back({ L });
+		return g_Entries.back();
+	}
+
+	static int Interval(const Entry& entry) {
+		return std::max(entry.tier, entry.every);
+	}
+
+	static bool Throttled(const Entry& entry) {
+		return Interval(entry) > 1 || entry.rate > 0;
+	}
+
+	// Expected cost per frame once the tier is taken into account
+	static double Amortized(const Entry& entry, int tier) {
+		return entry.cost / std::max(tier, entry.every);
+	}
+
+	// Windows that became active since the last call belong to the script that just ran
+	static void Claim(std::vector<ImGuiWindow*>& windows) {
+		ImGuiContext& g = *GImGui;
+		windows.clear();
+		for (ImGuiWindow* window : g.Windows) {
+			if (window->LastFrameActive != g.FrameCount)
+				continue;
+			if (std::find(g_Claimed.begin(), g_Claimed.end(), window) != g_Claimed.end())
+				continue;
+			g_Claimed.push_back(window);
+			windows.push_back(window);
+		}
+	}
+
+	// Keeps the rendered lists of the entry's windows, in draw order
+	static void Capture(Entry& entry, const ImDrawData& data) {
+		entry.replayCount = 0;
+		for (int i = 0; i < data.CmdListsCount; i++) {
+			const ImDrawList* list = data.CmdLists[i];
+			if (std::none_of(entry.windows.begin(), entry.windows.end(), [list](ImGuiWindow* window) { return window->DrawList == list; }))
+				continue;
+			if (entry.replayCount == static_cast<int>(entry.replay.size()))
+				entry.replay.push_back(std::make_unique<ImDrawList>(ImGui::GetDrawListSharedData()));
+			DrawSnapshot::CopyDrawList(*entry.replay[entry.replayCount++], *list);
+		}
+	}
+
+	static void Rebalance() {
+		if (g_BudgetMs <= 0) {
+			for (Entry& entry : g_Entries)
+				entry.tier = 1;
+			return;
+		}
+		if (g_Cooldown > 0) {
+			g_Cooldown--;
+			return;
+		}
+		double total = 0;
+		for (const Entry& entry : g_Entries)
+			total += Amortized(entry, entry.tier);
+
+		Entry* pick = nullptr;
+		if (total > g_BudgetMs) {
+			// Lowest priority first, then the most expensive
+			for (Entry& entry : g_Entries) {
+				if (entry.tier >= kMaxTier || entry.cost < kMinCost)
+					continue;
+				if (!pick || entry.priority < pick->priority || (entry.priority == pick->priority && entry.cost > pick->cost))
+					pick = &entry;
+			}
+			if (pick)
+				pick->tier *= 2;
+		}
+		else {
+			// Highest priority first, then the cheapest
+			for (Entry& entry : g_Entries) {
+				if (entry.tier == 1)
+					continue;
+				const double after = total - Amortized(entry, entry.tier) + Amortized(entry, entry.tier / 2);
+				if (after > g_BudgetMs * kHeadroom)
+					continue;
+				if (!pick || entry.priority > pick->priority || (entry.priority == pick->priority && entry.cost < pick->cost))
+					pick = &entry;
+			}
+			if (pick)
+				pick->tier /= 2;
+		}
+		if (pick)
+			g_Cooldown = kCooldown;
+	}
+
+	static void SetSchedule(sol::table schedule, sol::this_state s) {
+		Entry& entry = Get(s);
+		entry.rate = std::max(schedule.get_or("rate", 0.0), 0.0);
+		entry.every = std::clamp(schedule.get_or("every", 1), 1, 1000);
+		entry.priority = schedule.get_or("priority", 0);
+	}
+
+	static sol::table GetSchedule(sol::this_state s) {
+		sol::state_view lua(s);
+		const Entry& entry = Get(s);
+		return lua.create_table_with(
+			"tier", entry.tier,
+			"every", Interval(entry),
+			"rate", entry.rate,
+			"priority", entry.priority,
+			"cost_ms", entry.cost
+		);
+	}
+
+	static void SetUIBudget(double ms) {
+		g_BudgetMs = std::max(ms, 0.0);
+	}
+
+	static double GetUIBudget() {
+		return g_BudgetMs;
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("SetSchedule"					, SetSchedule);
+		ImGui.set_function("GetSchedule"					, GetSchedule);
+		ImGui.set_function("SetUIBudget"					, SetUIBudget);
+		ImGui.set_function("GetUIBudget"					, GetUIBudget);
+	}
+
+	void Forget(const std::vector<lua_State*>& removed) {
+		std::erase_if(g_Entries, [&](const Entry& entry) {
+			return std::find(removed.begin(), removed.end(), entry.L) != removed.end();
+		});
+	}
+
+	void Reset() {
+		for (Entry& entry : g_Entries) {
+			entry.lastFrame = 0;
+			entry.ran = false;
+			entry.windows.clear();
+			entry.replay.clear();
+			entry.replayCount = 0;
+		}
+		g_Claimed.clear();
+		g_Lists.clear();
+		g_Composed.Clear();
+	}
+
+	void BeginFrame() {
+		g_Frame++;
+		g_Now = Clock::now();
+		g_SpentMs = 0;
+		for (Entry& entry : g_Entries)
+			entry.ran = false;
+		// Whatever is active before the first script, such as ImGui's implicit debug window, is nobody's
+		g_Claimed.clear();
+		std::vector<ImGuiWindow*> unowned;
+		Claim(unowned);
+	}
+
+	void EndFrame() {
+		Rebalance();
+	}
+
+	bool ShouldRun(lua_State* L) {
+		const Entry& entry = Get(L);
+		if (entry.lastFrame == 0)
+			return true;
+		if (g_Frame - entry.lastFrame < static_cast<uint64_t>(Interval(entry)))
+			return false;
+		return entry.rate <= 0 || std::chrono::duration<double>(g_Now - entry.lastRun).count() >= 1.0 / entry.rate;
+	}
+
+	void Ran(lua_State* L, double ms) {
+		Entry& entry = Get(L);
+		entry.cost = entry.lastFrame == 0 ? ms : entry.cost * 0.8 + ms * 0.2;
+		entry.lastFrame = g_Frame;
+		entry.lastRun = g_Now;
+		entry.ran = true;
+		g_SpentMs += ms;
+		Claim(entry.windows);
+	}
+
+	double Leftover() {
+		return std::max(g_BudgetMs - g_SpentMs, 0.0);
+	}
+
+	uint64_t ReplayAge() {
+		uint64_t age = 0;
+		for (const Entry& entry : g_Entries) {
+			// A rate keeps a script out for any number of frames, so go by when it last ran
+			if (entry.replayCount > 0)
+				age = std::max(age, g_Frame + 1 - entry.lastFrame);
+		}
+		return age;
+	}
+
+	ImDrawData* Compose(ImDrawData* data) {
+		g_Lists.resize(0);
+		for (Entry& entry : g_Entries) {
+			if (!entry.ran) {
+				for (int i = 0; i < entry.replayCount; i++)
+					g_Lists.push_back(entry.replay[i].get());
+			}
+			else if (Throttled(entry)) {
+				Capture(entry, *data);
+			}
+			else {
+				entry.replay.clear();
+				entry.replayCount = 0;
+			}
+		}
+		if (g_Lists.empty() || !data->Valid)
+			return data;
+
+		// Replayed windows go below the live ones
+		g_Composed = *data;
+		for (int i = 0; i < g_Lists.Size; i++) {
+			g_Composed.TotalIdxCount += g_Lists[i]->IdxBuffer.Size;
+			g_Composed.TotalVtxCount += g_Lists[i]->VtxBuffer.Size;
+		}
+		for (int i = 0; i < data->CmdListsCount; i++)
+			g_Lists.push_back(data->CmdLists[i]);
+		g_Composed.CmdLists = g_Lists.Data;
+		g_Composed.CmdListsCount = g_Lists.Size;
+		return &g_Composed;
+	}
+
+}
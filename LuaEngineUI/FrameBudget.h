@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <imgui.h>
+#include <sol/sol.hpp>
+
+// Keeps the scripts' on_imgui pass inside a per-frame time budget. Each script runs at a tier:
+// every frame, every 2nd, 4th or 8th frame. When the amortized cost of all scripts exceeds the
+// budget the least important expensive script is moved down a tier, and moved back up once it
+// fits again. On frames a script sits out, the draw lists its windows produced last time are
+// drawn again, so the UI stays on screen; it just does not react until the script's next run.
+//
+//	ImGui.SetSchedule({ rate = 10, priority = 1 })	-- at most 10 Hz, throttled after lower priorities
+//	local s = ImGui.GetSchedule()					-- tier, every, rate, priority, cost_ms
+//	ImGui.SetUIBudget(2.5)							-- ms per frame; 0 turns throttling off
+namespace FrameBudget {
+
+	// Adds ImGui.SetSchedule/GetSchedule/SetUIBudget/GetUIBudget. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Drops the schedule of states that went away. Those states are never touched.
+	void Forget(const std::vector<lua_State*>& removed);
+
+	// Drops the kept draw lists and claimed windows, which point into the ImGui context and SRV heap
+	// about to be destroyed, and has every script run on the next frame. Schedules are kept.
+	void Reset();
+
+	// Bracket the on_imgui pass. Call between ImGui::NewFrame() and ImGui::Render().
+	void BeginFrame();
+	void EndFrame();
+
+	// Whether L's on_imgui is due this frame. Call Ran right after the call when it is.
+	bool ShouldRun(lua_State* L);
+	void Ran(lua_State* L, double ms);
+
+	// Budget left after this frame's on_imgui pass, in ms. 0 when throttling is off.
+	double Leftover();
+
+	// How many frames old the oldest list it may replay next frame will be by then, or 0 when it
+	// keeps none. Textures drawn into those lists must outlive them.
+	uint64_t ReplayAge();
+
+	// Call with ImGui::GetDrawData() after ImGui::Render(). Keeps the draw lists of throttled
+	// scripts that ran and returns draw data that also contains those of scripts that sat out.
+	ImDrawData* Compose(ImDrawData* data);
+
+}
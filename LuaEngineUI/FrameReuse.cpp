@@ -0,0 +1,119 @@
+#include "FrameReuse.h"
+#include <vector>
+
+#include "Hash.h"
+
+namespace FrameReuse {
+
+	struct Record {
+		bool valid = false;
+		uint64_t hash = 0;
+		// Index of the renderer call that recorded the list
+		uint64_t call = 0;
+	};
+
+	// Only the fields the renderer reads, without padding
+	struct PackedCmd {
+		float clip[4];
+		uint64_t texture;
+		uint64_t callback;
+		uint32_t vtxOffset;
+		uint32_t idxOffset;
+		uint32_t elemCount;
+		uint32_t pad;
+	};
+
+	static bool g_Enabled = true;
+	static std::vector<Record> g_Records;
+	static uint32_t g_FramesInFlight = 1;
+	static uint64_t g_Calls = 0;
+	static uint64_t g_Hits = 0;
+	static uint64_t g_Misses = 0;
+	static bool g_Reused = false;
+	static std::vector<PackedCmd> g_Packed;
+
+	static void SetFrameReuse(bool enabled) {
+		g_Enabled = enabled;
+	}
+
+	static sol::table GetFrameReuseStats(sol::this_state s) {
+		sol::state_view lua(s);
+		const uint64_t total = g_Hits + g_Misses;
+		return lua.create_table_with(
+			"enabled", g_Enabled,
+			"hits", g_Hits,
+			"misses", g_Misses,
+			"hit_rate", total ? static_cast<double>(g_Hits) / static_cast<double>(total) : 0.0
+		);
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("SetFrameReuse"					, SetFrameReuse);
+		ImGui.set_function("GetFrameReuseStats"				, GetFrameReuseStats);
+	}
+
+	void Reset(uint32_t backBuffers, uint32_t framesInFlight) {
+		g_Records.assign(backBuffers, Record{});
+		g_FramesInFlight = framesInFlight ? framesInFlight : 1;
+		g_Calls = 0;
+		g_Reused = false;
+	}
+
+	uint64_t Hash(const ImDrawData& data) {
+		const float display[6] = {
+			data.DisplayPos.x, data.DisplayPos.y,
+			data.DisplaySize.x, data.DisplaySize.y,
+			data.FramebufferScale.x, data.FramebufferScale.y,
+		};
+		uint64_t hash = Hash::Bytes(display, sizeof(display), static_cast<uint64_t>(data.CmdListsCount));
+		for (int i = 0; i < data.CmdListsCount; i++) {
+			const ImDrawList* list = data.CmdLists[i];
+			hash = Hash::Bytes(list->VtxBuffer.Data, list->VtxBuffer.size_in_bytes(), hash);
+			hash = Hash::Bytes(list->IdxBuffer.Data, list->IdxBuffer.size_in_bytes(), hash);
+
+			g_Packed.resize(list->CmdBuffer.Size);
+			for (int j = 0; j < list->CmdBuffer.Size; j++) {
+				const ImDrawCmd& cmd = list->CmdBuffer[j];
+				PackedCmd& packed = g_Packed[j];
+				packed.clip[0] = cmd.ClipRect.x;
+				packed.clip[1] = cmd.ClipRect.y;
+				packed.clip[2] = cmd.ClipRect.z;
+				packed.clip[3] = cmd.ClipRect.w;
+				packed.texture = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(cmd.TextureId));
+				packed.callback = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(cmd.UserCallback));
+				packed.vtxOffset = cmd.VtxOffset;
+				packed.idxOffset = cmd.IdxOffset;
+				packed.elemCount = cmd.ElemCount;
+				packed.pad = 0;
+			}
+			hash = Hash::Bytes(g_Packed.data(), g_Packed.size() * sizeof(PackedCmd), hash);
+		}
+		return hash;
+	}
+
+	bool CanReuse(uint32_t backBuffer, uint64_t hash) {
+		if (!g_Enabled || backBuffer >= g_Records.size())
+			return false;
+		const Record& record = g_Records[backBuffer];
+		// The backend cycles through framesInFlight buffer sets, one per call
+		if (!record.valid || record.hash != hash || g_Calls > record.call + g_FramesInFlight)
+			return false;
+		g_Hits++;
+		g_Reused = true;
+		return true;
+	}
+
+	bool MustDrain() {
+		return g_Reused;
+	}
+
+	void Recorded(uint32_t backBuffer, uint64_t hash) {
+		g_Misses++;
+		g_Reused = false;
+		if (backBuffer < g_Records.size())
+			g_Records[backBuffer] = { true, hash, g_Calls };
+		g_Calls++;
+	}
+
+}
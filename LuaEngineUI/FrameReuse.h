@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <imgui.h>
+#include <sol/sol.hpp>
+
+// Reuse of recorded UI command lists across identical frames. After ImGui::Render() the draw data
+// is hashed; when a back buffer's last recorded list was built from the same hash and the
+// renderer has not overwritten the vertex/index buffers it points at since, that closed list is
+// executed again instead of uploading and recording anew.
+//
+//	ImGui.SetFrameReuse(false)				-- on by default
+//	local r = ImGui.GetFrameReuseStats()	-- enabled, hits, misses, hit_rate
+namespace FrameReuse {
+
+	// Adds ImGui.SetFrameReuse/GetFrameReuseStats. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Forgets every recorded list. `framesInFlight` is what the renderer backend was initialized with.
+	void Reset(uint32_t backBuffers, uint32_t framesInFlight);
+
+	// Hash of everything the renderer reads from the draw data: display rect, vertices, indices
+	// and the draw commands' clip rects, textures, offsets and callbacks.
+	uint64_t Hash(const ImDrawData& data);
+
+	// Whether the list last recorded for `backBuffer` can be executed again for this hash.
+	bool CanReuse(uint32_t backBuffer, uint64_t hash);
+
+	// True when lists were reused since the last recording. The backend is then about to write
+	// buffers that a reused list still in flight may read, so the GPU has to be drained first.
+	bool MustDrain();
+
+	// A new list was recorded for `backBuffer` with one call into the renderer backend.
+	void Recorded(uint32_t backBuffer, uint64_t hash);
+
+}
@@ -0,0 +1,194 @@
+#include "GcPacer.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <string>
+
+namespace GcPacer {
+
+	using Clock = std::chrono::steady_clock;
+
+	enum class Mode : uint8_t {
+		Paced,
+		Incremental,
+		Generational,
+	};
+
+	// Work per LUA_GCSTEP call, in KB of "allocation" as Lua counts it
+	constexpr int kStepKB = 32;
+	// Even with no time left, collection keeps moving
+	constexpr double kMinSliceMs = 0.1;
+	constexpr int64_t kMinHeapKB = 1024;
+	// After a cycle, slices resume once the heap grew by half, and are forced once it doubled
+	constexpr double kResume = 1.5;
+	constexpr double kCeiling = 2.0;
+	// Paced states keep their collector running with this pause (percent growth before Lua starts a
+	// cycle on its own), well past the ceiling, so it only kicks in when Step stops being called
+	constexpr int kSafetyPause = 400;
+	constexpr int kDefaultPause = 200;
+
+	struct Entry {
+		lua_State* L;
+		Mode mode = Mode::Paced;
+		int64_t baseKB = 0;
+		bool collecting = false;
+		uint64_t steps = 0;
+		uint64_t cycles = 0;
+		uint64_t forced = 0;
+		double totalMs = 0;
+		double lastMs = 0;
+	};
+
+	static double g_SliceMs = 1.0;
+	static std::vector<Entry> g_Entries;
+	static size_t g_Next = 0;
+
+	static const char* ModeName(Mode mode) {
+		switch (mode) {
+		case Mode::Incremental:		return "incremental";
+		case Mode::Generational:	return "generational";
+		default:					return "paced";
+		}
+	}
+
+	static int64_t HeapKB(lua_State* L) {
+		return lua_gc(L, LUA_GCCOUNT, 0);
+	}
+
+	static Entry* Find(lua_State* L) {
+		for (Entry& entry : g_Entries) {
+			if (entry.L == L)
+				return &entry;
+		}
+		return nullptr;
+	}
+
+	static void Apply(Entry& entry) {
+		lua_State* L = entry.L;
+		if (entry.mode == Mode::Generational) {
+			lua_gc(L, LUA_GCGEN, 0, 0);
+			lua_gc(L, LUA_GCRESTART, 0);
+			return;
+		}
+		lua_gc(L, LUA_GCINC, entry.mode == Mode::Paced ? kSafetyPause : kDefaultPause, 0, 0);
+		lua_gc(L, LUA_GCRESTART, 0);
+		if (entry.mode == Mode::Paced)
+			entry.baseKB = HeapKB(L);
+	}
+
+	static int64_t ThresholdKB(const Entry& entry, double factor) {
+		return std::max(static_cast<int64_t>(static_cast<double>(entry.baseKB) * factor), kMinHeapKB);
+	}
+
+	static bool Due(const Entry& entry) {
+		return entry.mode == Mode::Paced && (entry.collecting || HeapKB(entry.L) >= ThresholdKB(entry, kResume));
+	}
+
+	// One slice of `kb` worth of work on a paced state. Returns its duration in ms.
+	static double StepOnce(Entry& entry, int kb = kStepKB) {
+		const auto start = Clock::now();
+		entry.collecting = true;
+		if (lua_gc(entry.L, LUA_GCSTEP, kb)) {
+			entry.cycles++;
+			entry.collecting = false;
+			entry.baseKB = HeapKB(entry.L);
+		}
+		const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		entry.steps++;
+		entry.totalMs += ms;
+		entry.lastMs += ms;
+		return ms;
+	}
+
+	static bool SetGCMode(const std::string& name, sol::this_state s) {
+		Entry* entry = Find(s);
+		if (!entry)
+			return false;
+		if (name == "paced")
+			entry->mode = Mode::Paced;
+		else if (name == "incremental")
+			entry->mode = Mode::Incremental;
+		else if (name == "generational")
+			entry->mode = Mode::Generational;
+		else
+			return false;
+		Apply(*entry);
+		return true;
+	}
+
+	static sol::object GetGCStats(sol::this_state s) {
+		sol::state_view lua(s);
+		const Entry* entry = Find(s);
+		if (!entry)
+			return sol::lua_nil;
+		return lua.create_table_with(
+			"mode", ModeName(entry->mode),
+			"heap_kb", HeapKB(s),
+			"base_kb", entry->baseKB,
+			"steps", entry->steps,
+			"cycles", entry->cycles,
+			"forced_steps", entry->forced,
+			"total_ms", entry->totalMs,
+			"last_ms", entry->lastMs
+		);
+	}
+
+	static void SetGCSlice(double ms) {
+		g_SliceMs = std::max(ms, 0.0);
+	}
+
+	void Init(sol::state_view& lua) {
+		lua_State* L = lua.lua_state();
+		if (!Find(L)) {
+			g_Entries.push_back({ L });
+			Apply(g_Entries.back());
+		}
+
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("SetGCMode"						, SetGCMode);
+		ImGui.set_function("GetGCStats"						, GetGCStats);
+		ImGui.set_function("SetGCSlice"						, SetGCSlice);
+	}
+
+	void Forget(const std::vector<lua_State*>& removed) {
+		std::erase_if(g_Entries, [&](const Entry& entry) {
+			return std::find(removed.begin(), removed.end(), entry.L) != removed.end();
+		});
+		g_Next = 0;
+	}
+
+	void Step(double leftoverMs) {
+		for (Entry& entry : g_Entries)
+			entry.lastMs = 0;
+
+		// Over the ceiling: work off the whole overshoot no matter the slice. Scripts also allocate
+		// outside the UI pass, so a single step per frame could fall behind for good.
+		for (Entry& entry : g_Entries) {
+			if (entry.mode != Mode::Paced)
+				continue;
+			for (int64_t over; (over = HeapKB(entry.L) - ThresholdKB(entry, kCeiling)) > 0;) {
+				const uint64_t cycles = entry.cycles;
+				StepOnce(entry, static_cast<int>(std::clamp<int64_t>(over, kStepKB, INT_MAX)));
+				entry.forced++;
+				// A finished cycle moved the ceiling above the live heap
+				if (entry.cycles != cycles)
+					break;
+			}
+		}
+
+		const double slice = std::clamp(leftoverMs, kMinSliceMs, std::max(g_SliceMs, kMinSliceMs));
+		double spent = 0;
+		size_t idle = 0;
+		while (spent < slice && idle < g_Entries.size()) {
+			Entry& entry = g_Entries[g_Next];
+			g_Next = (g_Next + 1) % g_Entries.size();
+			if (!Due(entry)) {
+				idle++;
+				continue;
+			}
+			idle = 0;
+			spent += StepOnce(entry);
+		}
+	}
+
+}
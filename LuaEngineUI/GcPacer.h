@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <sol/sol.hpp>
+
+// Frame-paced garbage collection. By default each script state's collector is switched to
+// incremental mode with its pause raised to 400%, and the UI layer runs it in small LUA_GCSTEP
+// slices once per frame, after the frame's commands were submitted, round-robin across states.
+// Collection work then lands at a fixed point in the frame instead of inside whatever allocation
+// tripped it. A state gets slices once its heap grew by half since the last cycle; one that
+// doubled is stepped regardless of the slice until it is back under that ceiling, so a fast
+// allocator cannot run away. Frames the UI skips still call Step, since scripts allocate outside
+// the UI too. The raised pause is only a safety net: if Present stops being called, Lua still
+// collects on its own once a heap grew fourfold.
+//
+//	ImGui.SetGCMode("generational")		-- "paced" (default), "incremental" or "generational"
+//	ImGui.SetGCSlice(0.5)				-- ms per frame shared by all paced states
+//	local gc = ImGui.GetGCStats()		-- mode, heap_kb, base_kb, steps, cycles, forced_steps, total_ms, last_ms
+namespace GcPacer {
+
+	// Adds ImGui.SetGCMode/GetGCStats/SetGCSlice and puts the state's collector under pacing.
+	// Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Drops states that went away. Those states are never touched.
+	void Forget(const std::vector<lua_State*>& removed);
+
+	// Runs collection slices for up to `leftoverMs`, capped by the configured slice.
+	void Step(double leftoverMs);
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// XXH64 (https://github.com/Cyan4973/xxHash), same output as the reference implementation.
+// The four independent accumulators of the main loop are what lets the compiler keep them in
+// vector registers; there is nothing platform-specific here.
+namespace Hash {
+
+	namespace detail {
+
+		constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+		constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+		constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+		constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+		constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+		inline uint64_t Rotl(uint64_t x, int r) {
+			return (x << r) | (x >> (64 - r));
+		}
+
+		inline uint64_t Read64(const uint8_t* p) {
+			uint64_t v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		inline uint32_t Read32(const uint8_t* p) {
+			uint32_t v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		inline uint64_t Round(uint64_t acc, uint64_t input) {
+			acc += input * kPrime2;
+			acc = Rotl(acc, 31);
+			return acc * kPrime1;
+		}
+
+		inline uint64_t Merge(uint64_t acc, uint64_t val) {
+			acc ^= Round(0, val);
+			return acc * kPrime1 + kPrime4;
+		}
+
+	}
+
+	// Little-endian input, as on every target this DLL runs on.
+	inline uint64_t Bytes(const void* data, size_t size, uint64_t seed = 0) {
+		using namespace detail;
+		const uint8_t* p = static_cast<const uint8_t*>(data);
+		const uint8_t* const end = p + size;
+		uint64_t h;
+
+		if (size >= 32) {
+			uint64_t v1 = seed + kPrime1 + kPrime2;
+			uint64_t v2 = seed + kPrime2;
+			uint64_t v3 = seed;
+			uint64_t v4 = seed - kPrime1;
+			const uint8_t* const limit = end - 32;
+			do {
+				v1 = Round(v1, Read64(p));
+				v2 = Round(v2, Read64(p + 8));
+				v3 = Round(v3, Read64(p + 16));
+				v4 = Round(v4, Read64(p + 24));
+				p += 32;
+			} while (p <= limit);
+			h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+			h = Merge(h, v1);
+			h = Merge(h, v2);
+			h = Merge(h, v3);
+			h = Merge(h, v4);
+		}
+		else {
+			h = seed + kPrime5;
+		}
+		h += static_cast<uint64_t>(size);
+
+		while (p + 8 <= end) {
+			h ^= Round(0, Read64(p));
+			h = Rotl(h, 27) * kPrime1 + kPrime4;
+			p += 8;
+		}
+		if (p + 4 <= end) {
+			h ^= static_cast<uint64_t>(Read32(p)) * kPrime1;
+			h = Rotl(h, 23) * kPrime2 + kPrime3;
+			p += 4;
+		}
+		while (p < end) {
+			h ^= (*p) * kPrime5;
+			h = Rotl(h, 11) * kPrime1;
+			p++;
+		}
+
+		h ^= h >> 33;
+		h *= kPrime2;
+		h ^= h >> 29;
+		h *= kPrime3;
+		h ^= h >> 32;
+		return h;
+	}
+
+}
@@ -0,0 +1,131 @@
+#include "IconAtlas.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "RectPacker.h"
+
+namespace IconAtlas {
+
+	// Transparent border around each icon, so linear filtering doesn't pick up its neighbours
+	constexpr int kPadding = 1;
+
+	struct Page {
+		RectPacker::Skyline packer;
+		TextureLoader::Image image;
+		TextureCache::Texture texture;
+		bool uploaded = false;
+		// Region written since the last upload; empty while x0 >= x1
+		int x0 = INT_MAX;
+		int y0 = INT_MAX;
+		int x1 = 0;
+		int y1 = 0;
+	};
+
+	static std::vector<std::unique_ptr<Page>> g_Pages;
+
+	static void Clean(Page& page) {
+		page.x0 = page.y0 = INT_MAX;
+		page.x1 = page.y1 = 0;
+	}
+
+	bool Add(const TextureLoader::Image& image, Placement& out) {
+		if (image.format != TextureLoader::Format::RGBA8 || image.mips != 1)
+			return false;
+		if (image.width > kMaxIcon || image.height > kMaxIcon)
+			return false;
+		const int w = image.width + kPadding * 2;
+		const int h = image.height + kPadding * 2;
+		int x = 0;
+		int y = 0;
+		uint32_t index = 0;
+		for (; index < g_Pages.size(); index++) {
+			if (g_Pages[index]->packer.Insert(w, h, x, y))
+				break;
+		}
+		if (index == g_Pages.size()) {
+			auto page = std::make_unique<Page>();
+			page->packer.Reset(kPageSize, kPageSize);
+			page->image.width = page->image.height = kPageSize;
+			page->image.pixels.assign(static_cast<size_t>(kPageSize) * kPageSize * 4, 0);
+			if (!page->packer.Insert(w, h, x, y))
+				return false;
+			g_Pages.push_back(std::move(page));
+		}
+
+		Page& page = *g_Pages[index];
+		x += kPadding;
+		y += kPadding;
+		const size_t rowBytes = static_cast<size_t>(image.width) * 4;
+		for (int row = 0; row < image.height; row++)
+			memcpy(&page.image.pixels[(static_cast<size_t>(y + row) * kPageSize + x) * 4], image.Data() + row * rowBytes, rowBytes);
+		page.x0 = std::min(page.x0, x);
+		page.y0 = std::min(page.y0, y);
+		page.x1 = std::max(page.x1, x + image.width);
+		page.y1 = std::max(page.y1, y + image.height);
+
+		out = { index, x, y, image.width, image.height };
+		return true;
+	}
+
+	void Update(TextureCache::UploadFn upload, TextureCache::UpdateFn update) {
+		if (!upload || !update)
+			return;
+		TextureLoader::Image region;
+		for (auto& page : g_Pages) {
+			if (!page->uploaded) {
+				if (upload(page->image, page->texture)) {
+					page->uploaded = true;
+					Clean(*page);
+				}
+				continue;
+			}
+			if (page->x0 >= page->x1)
+				continue;
+			// The dirty box can cover icons that frames in flight are drawing. It rewrites them with
+			// the same pixels, and `update` waits for those frames before it copies (see UpdateFn)
+			region.width = page->x1 - page->x0;
+			region.height = page->y1 - page->y0;
+			region.pixels.resize(static_cast<size_t>(region.width) * region.height * 4);
+			const size_t rowBytes = static_cast<size_t>(region.width) * 4;
+			for (int row = 0; row < region.height; row++)
+				memcpy(&region.pixels[row * rowBytes], &page->image.pixels[(static_cast<size_t>(page->y0 + row) * kPageSize + page->x0) * 4], rowBytes);
+			if (update(page->texture, page->x0, page->y0, region))
+				Clean(*page);
+		}
+	}
+
+	bool Resolve(const Placement& placement, ImTextureID& id, ImVec4& uv) {
+		if (placement.page >= g_Pages.size() || !g_Pages[placement.page]->uploaded)
+			return false;
+		constexpr float scale = 1.0f / kPageSize;
+		id = (ImTextureID)g_Pages[placement.page]->texture.id;
+		uv = ImVec4(placement.x * scale, placement.y * scale, (placement.x + placement.width) * scale, (placement.y + placement.height) * scale);
+		return true;
+	}
+
+	void Reset(TextureCache::ReleaseFn release) {
+		for (auto& page : g_Pages) {
+			if (page->uploaded && release)
+				release(page->texture);
+			page->texture = TextureCache::Texture();
+			page->uploaded = false;
+		}
+	}
+
+	size_t Pages() {
+		return g_Pages.size();
+	}
+
+	float Occupancy() {
+		if (g_Pages.empty())
+			return 0.0f;
+		float total = 0.0f;
+		for (const auto& page : g_Pages)
+			total += page->packer.Occupancy();
+		return total / static_cast<float>(g_Pages.size());
+	}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <imgui.h>
+
+#include "TextureCache.h"
+
+// Shared pages for small images, so a script drawing dozens of icons binds one texture instead of
+// dozens. Icons are packed into CPU copies of the pages; Update uploads a new page whole and
+// afterwards only the region that changed. Space of dropped icons is not reclaimed.
+namespace IconAtlas {
+
+	constexpr int kPageSize = 1024;
+	// Bigger images get a texture of their own
+	constexpr int kMaxIcon = 256;
+
+	struct Placement {
+		uint32_t page = 0;
+		int x = 0;
+		int y = 0;
+		int width = 0;
+		int height = 0;
+	};
+
+	// Packs a single-level RGBA image into a page, opening a new one when none has room.
+	bool Add(const TextureLoader::Image& image, Placement& out);
+
+	// Uploads what was packed since the last call.
+	void Update(TextureCache::UploadFn upload, TextureCache::UpdateFn update);
+
+	// The page texture and the icon's uv rect (x0, y0, x1, y1); false until the page is on the GPU.
+	bool Resolve(const Placement& placement, ImTextureID& id, ImVec4& uv);
+
+	// Drops the GPU pages; the next Update uploads them again from the CPU copies.
+	void Reset(TextureCache::ReleaseFn release);
+
+	size_t Pages();
+	float Occupancy();
+
+}
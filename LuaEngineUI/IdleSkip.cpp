@@ -0,0 +1,66 @@
+#include "IdleSkip.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+namespace IdleSkip {
+
+	using Clock = std::chrono::steady_clock;
+
+	static bool g_Enabled = false;
+	static Clock::duration g_Wake = std::chrono::milliseconds(250);
+	static std::atomic<bool> g_Input{ false };
+	static std::atomic<bool> g_Redraw{ false };
+	// Until a frame has been rendered there is nothing to compare against
+	static bool g_Drew = true;
+	static Clock::time_point g_LastFrame;
+	static uint64_t g_Rendered = 0;
+	static uint64_t g_Skipped = 0;
+
+	static void SetIdleMode(bool enabled, sol::optional<double> wakeMs) {
+		g_Enabled = enabled;
+		if (wakeMs)
+			g_Wake = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(std::max(*wakeMs, 0.0)));
+	}
+
+	static void RequestRedraw() {
+		g_Redraw.store(true, std::memory_order_relaxed);
+	}
+
+	static sol::table GetIdleStats(sol::this_state s) {
+		sol::state_view lua(s);
+		return lua.create_table_with(
+			"enabled", g_Enabled,
+			"rendered", g_Rendered,
+			"skipped", g_Skipped
+		);
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("SetIdleMode"					, SetIdleMode);
+		ImGui.set_function("RequestRedraw"					, RequestRedraw);
+		ImGui.set_function("GetIdleStats"					, GetIdleStats);
+	}
+
+	void NotifyInput() {
+		g_Input.store(true, std::memory_order_relaxed);
+	}
+
+	bool ShouldSkip(bool wake) {
+		// Both flags are consumed, so input that arrives while we run wakes the next frame
+		const bool input = g_Input.exchange(false, std::memory_order_relaxed);
+		const bool redraw = g_Redraw.exchange(false, std::memory_order_relaxed);
+		if (!g_Enabled || wake || input || redraw || g_Drew || Clock::now() - g_LastFrame >= g_Wake)
+			return false;
+		g_Skipped++;
+		return true;
+	}
+
+	void Rendered(const ImDrawData* data) {
+		g_Drew = data && data->Valid && data->TotalVtxCount > 0;
+		g_LastFrame = Clock::now();
+		g_Rendered++;
+	}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <imgui.h>
+#include <sol/sol.hpp>
+
+// Opt-in idle mode for the present hook. While the last UI frame drew nothing, no input arrived,
+// nobody asked for a redraw and no background work (tasks, texture loads) is waiting for the next
+// frame, HookPresent skips the ImGui frame, the Lua pass and the command list entirely. A timer
+// still runs the scripts every so often, so windows that open on game state rather than on a key
+// press still show up.
+//
+//	ImGui.SetIdleMode(true, 250)	-- skip idle frames, run the scripts at least every 250 ms
+//	ImGui.RequestRedraw()			-- from any callback: run the UI on the next frame
+//	local s = ImGui.GetIdleStats()	-- enabled, rendered, skipped
+namespace IdleSkip {
+
+	// Adds ImGui.SetIdleMode/RequestRedraw/GetIdleStats. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Called from the window procedure for mouse and keyboard messages. Thread-safe.
+	void NotifyInput();
+
+	// Whether this frame can be skipped. `wake` forces a frame, e.g. for a pending reload or for
+	// background work that only moves on while frames run.
+	bool ShouldSkip(bool wake);
+
+	// Call with the draw data that was rendered.
+	void Rendered(const ImDrawData* data);
+
+}
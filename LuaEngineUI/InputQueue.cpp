@@ -0,0 +1,58 @@
+#include "InputQueue.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace InputQueue {
+
+	struct Event {
+		uint32_t msg;
+		uint64_t wParam;
+		int64_t lParam;
+	};
+
+	static std::mutex g_Mutex;
+	static std::vector<Event> g_Queue;
+	static std::vector<Event> g_Draining;
+	static std::atomic<bool> g_WantMouse{ false };
+	static std::atomic<bool> g_WantKeyboard{ false };
+
+	void Push(uint32_t msg, uint64_t wParam, int64_t lParam) {
+		std::lock_guard lock(g_Mutex);
+		g_Queue.push_back({ msg, wParam, lParam });
+	}
+
+	void Drain(bool (*apply)(uint32_t msg, uint64_t wParam, int64_t lParam)) {
+		{
+			std::lock_guard lock(g_Mutex);
+			g_Draining.swap(g_Queue);
+		}
+		size_t applied = 0;
+		while (applied < g_Draining.size()) {
+			const Event& event = g_Draining[applied];
+			if (!apply(event.msg, event.wParam, event.lParam))
+				break;
+			applied++;
+		}
+		if (applied < g_Draining.size()) {
+			// Whatever arrived meanwhile goes after the refused messages
+			std::lock_guard lock(g_Mutex);
+			g_Queue.insert(g_Queue.begin(), g_Draining.begin() + applied, g_Draining.end());
+		}
+		g_Draining.clear();
+	}
+
+	void PublishCapture(bool mouse, bool keyboard) {
+		g_WantMouse.store(mouse, std::memory_order_relaxed);
+		g_WantKeyboard.store(keyboard, std::memory_order_relaxed);
+	}
+
+	bool WantCaptureMouse() {
+		return g_WantMouse.load(std::memory_order_relaxed);
+	}
+
+	bool WantCaptureKeyboard() {
+		return g_WantKeyboard.load(std::memory_order_relaxed);
+	}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Window messages on their way to ImGui. The window procedure pushes them from the game's window
+// thread; the present hook drains them right before NewFrame. Frames that are not built (reduced
+// update rate, idle skip) therefore lose no input.
+namespace InputQueue {
+
+	void Push(uint32_t msg, uint64_t wParam, int64_t lParam);
+
+	// Hands queued messages to `apply` in order. When `apply` refuses one, it and everything after
+	// it stay queued for the next frame.
+	void Drain(bool (*apply)(uint32_t msg, uint64_t wParam, int64_t lParam));
+
+	// ImGui's capture flags as of the last built frame, for the window procedure.
+	void PublishCapture(bool mouse, bool keyboard);
+	bool WantCaptureMouse();
+	bool WantCaptureKeyboard();
+
+}
@@ -0,0 +1,271 @@
+#include "LuaProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace LuaProfiler {
+
+	using Clock = std::chrono::steady_clock;
+
+	// Per-state allocator wrapper and the hook it replaced. Kept alive until the state is gone,
+	// since lua_close still frees through TrackingAlloc.
+	struct Tracker {
+		lua_State* L = nullptr;
+		lua_Alloc allocf = nullptr;
+		void* allocud = nullptr;
+		lua_Hook hook = nullptr;
+		int hookMask = 0;
+		int hookCount = 0;
+		// Another allocator wrapper was chained over ours, so the state still calls into this one
+		bool parked = false;
+		std::atomic<uint64_t> allocs{ 0 };
+		std::atomic<uint64_t> bytes{ 0 };
+		std::atomic<uint64_t> freed{ 0 };
+	};
+
+	struct CallStat {
+		uint64_t calls = 0;
+		uint64_t ns = 0;
+	};
+
+	struct PendingCall {
+		lua_State* L;
+		const char* name;
+		Clock::time_point start;
+	};
+
+	struct FrameTotals {
+		uint64_t frames = 0;
+		uint64_t allocs = 0;
+		uint64_t bytes = 0;
+		uint64_t freed = 0;
+		uint64_t ns = 0;
+	};
+
+	struct NameHash {
+		using is_transparent = void;
+		size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+	};
+
+	static bool g_Enabled = false;
+	static std::vector<lua_State*> g_Live;
+	static std::vector<std::unique_ptr<Tracker>> g_Trackers;
+
+	static std::mutex g_StatsMutex;
+	static std::unordered_map<std::string, CallStat, NameHash, std::equal_to<>> g_CallStats;
+	static thread_local std::vector<PendingCall> t_Calls;
+	// A Lua error longjmps past the return hook and leaves its calls pending. Bumping the epoch
+	// drops them on every thread the next time that thread enters the hook.
+	static std::atomic<uint64_t> g_CallEpoch{ 0 };
+	static thread_local uint64_t t_CallEpoch = 0;
+
+	static FrameTotals g_Totals;
+	static FrameTotals g_FrameStart;
+	static Clock::time_point g_FrameStartTime;
+	static bool g_FrameOpen = false;
+
+	static void* TrackingAlloc(void* ud, void* ptr, size_t osize, size_t nsize) {
+		Tracker* t = static_cast<Tracker*>(ud);
+		if (nsize == 0) {
+			if (ptr)
+				t->freed.fetch_add(osize, std::memory_order_relaxed);
+		}
+		else if (!ptr || nsize > osize) {
+			// With ptr == NULL, osize is the object type, not a size
+			t->allocs.fetch_add(1, std::memory_order_relaxed);
+			t->bytes.fetch_add(ptr ? nsize - osize : nsize, std::memory_order_relaxed);
+		}
+		else {
+			t->freed.fetch_add(osize - nsize, std::memory_order_relaxed);
+		}
+		return t->allocf(t->allocud, ptr, osize, nsize);
+	}
+
+	// Only C functions are timed; Lua functions are the scripts themselves.
+	static void Hook(lua_State* L, lua_Debug* ar) {
+		const uint64_t epoch = g_CallEpoch.load(std::memory_order_relaxed);
+		if (t_CallEpoch != epoch) {
+			t_Calls.clear();
+			t_CallEpoch = epoch;
+		}
+		if (ar->event == LUA_HOOKCALL || ar->event == LUA_HOOKTAILCALL) {
+			if (lua_getinfo(L, "Sn", ar) && ar->what[0] == 'C')
+				t_Calls.push_back({ L, ar->name ? ar->name : "?", Clock::now() });
+		}
+		else if (ar->event == LUA_HOOKRET) {
+			if (t_Calls.empty() || t_Calls.back().L != L || !lua_getinfo(L, "S", ar) || ar->what[0] != 'C')
+				return;
+			const PendingCall call = t_Calls.back();
+			t_Calls.pop_back();
+			const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - call.start).count();
+
+			std::lock_guard lock(g_StatsMutex);
+			auto it = g_CallStats.find(std::string_view(call.name));
+			if (it == g_CallStats.end())
+				it = g_CallStats.emplace(call.name, CallStat{}).first;
+			it->second.calls++;
+			it->second.ns += ns;
+		}
+	}
+
+	static bool IsAttached(const Tracker& t) {
+		void* ud = nullptr;
+		return lua_getallocf(t.L, &ud) == TrackingAlloc && ud == &t;
+	}
+
+	// Any hook the state already had is parked while profiling and restored by Detach.
+	static void Attach(Tracker& t) {
+		t.allocf = lua_getallocf(t.L, &t.allocud);
+		lua_setallocf(t.L, TrackingAlloc, &t);
+		t.hook = lua_gethook(t.L);
+		t.hookMask = lua_gethookmask(t.L);
+		t.hookCount = lua_gethookcount(t.L);
+		lua_sethook(t.L, Hook, LUA_MASKCALL | LUA_MASKRET, 0);
+	}
+
+	// The state must still be open. Returns false when the tracker can't be unhooked and has to
+	// stay alive until the state closes.
+	static bool Detach(Tracker& t) {
+		if (t.parked)
+			return false;
+		lua_sethook(t.L, t.hook, t.hookMask, t.hookCount);
+		if (!IsAttached(t)) {
+			t.parked = true;
+			return false;
+		}
+		lua_setallocf(t.L, t.allocf, t.allocud);
+		return true;
+	}
+
+	static bool Tracked(lua_State* L) {
+		return std::any_of(g_Trackers.begin(), g_Trackers.end(), [L](const auto& t) { return t->L == L; });
+	}
+
+	static void Track(lua_State* L) {
+		auto t = std::make_unique<Tracker>();
+		t->L = L;
+		Attach(*t);
+		g_Trackers.push_back(std::move(t));
+	}
+
+	static FrameTotals Sum() {
+		FrameTotals sum;
+		for (const auto& t : g_Trackers) {
+			sum.allocs += t->allocs.load(std::memory_order_relaxed);
+			sum.bytes += t->bytes.load(std::memory_order_relaxed);
+			sum.freed += t->freed.load(std::memory_order_relaxed);
+		}
+		return sum;
+	}
+
+	static void SetEnabled(bool enabled) {
+		if (enabled == g_Enabled)
+			return;
+		g_Enabled = enabled;
+		if (!enabled) {
+			std::erase_if(g_Trackers, [](const auto& t) { return Detach(*t); });
+			g_CallEpoch.fetch_add(1, std::memory_order_relaxed);
+			g_FrameOpen = false;
+			return;
+		}
+		for (lua_State* L : g_Live) {
+			if (!Tracked(L))
+				Track(L);
+		}
+	}
+
+	static void Reset() {
+		std::lock_guard lock(g_StatsMutex);
+		g_CallStats.clear();
+		g_Totals = {};
+	}
+
+	static sol::table GetBindingStats(sol::this_state s) {
+		sol::state_view lua(s);
+		std::vector<std::pair<std::string, CallStat>> sorted;
+		{
+			std::lock_guard lock(g_StatsMutex);
+			sorted.assign(g_CallStats.begin(), g_CallStats.end());
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.ns > b.second.ns; });
+
+		sol::table result = lua.create_table(static_cast<int>(sorted.size()), 0);
+		for (size_t i = 0; i < sorted.size(); i++) {
+			const CallStat& stat = sorted[i].second;
+			result[i + 1] = lua.create_table_with(
+				"name", sorted[i].first,
+				"calls", stat.calls,
+				"ns_per_call", static_cast<double>(stat.ns) / static_cast<double>(stat.calls),
+				"total_ms", static_cast<double>(stat.ns) / 1e6
+			);
+		}
+		return result;
+	}
+
+	static sol::table GetLuaFrameStats(sol::this_state s) {
+		sol::state_view lua(s);
+		const double frames = static_cast<double>(std::max<uint64_t>(g_Totals.frames, 1));
+		return lua.create_table_with(
+			"frames", g_Totals.frames,
+			"ms_per_frame", static_cast<double>(g_Totals.ns) / 1e6 / frames,
+			"allocs_per_frame", static_cast<double>(g_Totals.allocs) / frames,
+			"bytes_per_frame", static_cast<double>(g_Totals.bytes) / frames,
+			"freed_per_frame", static_cast<double>(g_Totals.freed) / frames
+		);
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("ProfileBindings"				, SetEnabled);
+		ImGui.set_function("GetBindingStats"				, GetBindingStats);
+		ImGui.set_function("GetLuaFrameStats"				, GetLuaFrameStats);
+		ImGui.set_function("ResetBindingStats"				, Reset);
+	}
+
+	void Sync(const std::vector<lua_State*>& live, const std::vector<lua_State*>& removed) {
+		g_Live = live;
+		// A closed state (or one replaced at the same address) did its last frees through the
+		// tracker already, so it is dropped untouched
+		std::erase_if(g_Trackers, [&](const auto& t) {
+			return std::find(removed.begin(), removed.end(), t->L) != removed.end();
+		});
+		// A stopped state is still open and keeps allocating; it gets its allocator back first
+		std::erase_if(g_Trackers, [&](const auto& t) {
+			return std::find(live.begin(), live.end(), t->L) == live.end() && Detach(*t);
+		});
+		if (!g_Enabled)
+			return;
+		for (lua_State* L : live) {
+			if (!Tracked(L))
+				Track(L);
+		}
+	}
+
+	void BeginFrame() {
+		if (!g_Enabled)
+			return;
+		g_FrameStart = Sum();
+		g_FrameStartTime = Clock::now();
+		g_FrameOpen = true;
+		g_CallEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EndFrame() {
+		// Profiling may have been switched on by a script halfway through the frame
+		if (!g_Enabled || !g_FrameOpen)
+			return;
+		g_FrameOpen = false;
+		const FrameTotals now = Sum();
+		g_Totals.frames++;
+		g_Totals.allocs += now.allocs - g_FrameStart.allocs;
+		g_Totals.bytes += now.bytes - g_FrameStart.bytes;
+		g_Totals.freed += now.freed - g_FrameStart.freed;
+		g_Totals.ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - g_FrameStartTime).count();
+	}
+
+}
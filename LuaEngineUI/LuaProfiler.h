@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+#include <sol/sol.hpp>
+
+// Opt-in measurement of the binding layer from inside the game. While enabled, every C function
+// called from Lua is timed through a call/return hook, and each state's allocator is wrapped to
+// count allocations and freed bytes per frame.
+//
+//	ImGui.ProfileBindings(true)
+//	for _, s in ipairs(ImGui.GetBindingStats()) do print(s.name, s.calls, s.ns_per_call) end
+//	local f = ImGui.GetLuaFrameStats()	-- frames, ms_per_frame, allocs_per_frame, bytes_per_frame, freed_per_frame
+namespace LuaProfiler {
+
+	// Adds ImGui.ProfileBindings/GetBindingStats/GetLuaFrameStats/ResetBindingStats. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Tracks the started script states (LuaUI::Changes::live). States in `removed` are forgotten
+	// without being touched; any other state missing from `live` gets its allocator and hook back.
+	void Sync(const std::vector<lua_State*>& live, const std::vector<lua_State*>& removed);
+
+	// Bracket the per-frame Lua UI pass.
+	void BeginFrame();
+	void EndFrame();
+
+}
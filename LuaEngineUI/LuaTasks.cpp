@@ -0,0 +1,187 @@
+#include "LuaTasks.h"
+#include <algorithm>
+#include <chrono>
+
+#include "loader.h"
+
+namespace LuaTasks {
+
+	using Clock = std::chrono::steady_clock;
+
+	// Instructions between two deadline checks
+	constexpr int kHookCount = 1000;
+
+	struct Task {
+		// Main thread of the owning state
+		lua_State* L;
+		lua_State* co;
+		int threadRef;
+		int handleRef;
+		int nargs;
+		bool started;
+	};
+
+	static double g_SliceMs = 2.0;
+	static std::vector<Task> g_Tasks;
+	static std::vector<lua_State*> g_Live;
+	static size_t g_Next = 0;
+	static lua_State* g_Current = nullptr;
+	static Clock::time_point g_Deadline;
+
+	static double g_UsedMs = 0;
+	static double g_TotalUsedMs = 0;
+	static uint64_t g_Frames = 0;
+	static uint64_t g_Resumes = 0;
+	static uint64_t g_Completed = 0;
+	static uint64_t g_Failed = 0;
+
+	static bool Live(const Task& task) {
+		return std::find(g_Live.begin(), g_Live.end(), task.L) != g_Live.end();
+	}
+
+	static lua_State* MainThread(lua_State* L) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_MAINTHREAD);
+		lua_State* main = lua_tothread(L, -1);
+		lua_pop(L, 1);
+		return main;
+	}
+
+	// Suspends the running task once the slice is over. Coroutines the task starts itself inherit
+	// the hook but are left alone, since a yield there would land in the task, not in Run.
+	static void Preempt(lua_State* L, lua_Debug*) {
+		if (L == g_Current && Clock::now() >= g_Deadline && lua_isyieldable(L))
+			lua_yield(L, 0);
+	}
+
+	static int Spawn(lua_State* L) {
+		luaL_checktype(L, 1, LUA_TFUNCTION);
+		const int nargs = lua_gettop(L) - 1;
+		lua_State* co = lua_newthread(L);
+		lua_sethook(co, Preempt, LUA_MASKCOUNT, kHookCount);
+		const int threadRef = luaL_ref(L, LUA_REGISTRYINDEX);
+		// The function and its arguments become the coroutine's initial stack
+		lua_xmove(L, co, nargs + 1);
+
+		lua_createtable(L, 0, 4);
+		lua_pushboolean(L, 0);
+		lua_setfield(L, -2, "done");
+		lua_pushvalue(L, -1);
+		const int handleRef = luaL_ref(L, LUA_REGISTRYINDEX);
+		g_Tasks.push_back({ MainThread(L), co, threadRef, handleRef, nargs, false });
+		return 1;
+	}
+
+	// Fills in the handle and releases the task's references
+	static void Finish(const Task& task, int status, int nres) {
+		lua_State* L = task.L;
+		lua_rawgeti(L, LUA_REGISTRYINDEX, task.handleRef);
+		const int handle = lua_gettop(L);
+		lua_pushboolean(L, 1);
+		lua_setfield(L, handle, "done");
+		lua_pushboolean(L, status == LUA_OK);
+		lua_setfield(L, handle, "ok");
+		if (status == LUA_OK) {
+			lua_createtable(L, nres, 0);
+			lua_xmove(task.co, L, nres);
+			for (int i = nres; i >= 1; i--)
+				lua_rawseti(L, handle + 1, i);
+			if (nres > 0) {
+				lua_rawgeti(L, handle + 1, 1);
+				lua_setfield(L, handle, "result");
+			}
+			lua_setfield(L, handle, "results");
+			g_Completed++;
+		}
+		else {
+			// The coroutine's stack is not unwound on error, so its traceback is still there
+			const char* error = lua_tostring(task.co, -1);
+			luaL_traceback(L, task.co, error ? error : "(non-string error)", 0);
+			loader::LOG(loader::ERR) << "[LuaEngineUI] task: " << lua_tostring(L, -1);
+			lua_setfield(L, handle, "error");
+			g_Failed++;
+		}
+		lua_pop(L, 1);
+		luaL_unref(L, LUA_REGISTRYINDEX, task.threadRef);
+		luaL_unref(L, LUA_REGISTRYINDEX, task.handleRef);
+	}
+
+	static void SetTaskSlice(double ms) {
+		g_SliceMs = std::max(ms, 0.0);
+	}
+
+	static sol::table GetTaskStats(sol::this_state s) {
+		sol::state_view lua(s);
+		return lua.create_table_with(
+			"tasks", g_Tasks.size(),
+			"slice_ms", g_SliceMs,
+			"used_ms", g_UsedMs,
+			"usage", g_SliceMs > 0 ? g_UsedMs / g_SliceMs : 0.0,
+			"avg_used_ms", g_Frames ? g_TotalUsedMs / static_cast<double>(g_Frames) : 0.0,
+			"resumes", g_Resumes,
+			"completed", g_Completed,
+			"failed", g_Failed
+		);
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("Spawn"							, Spawn);
+		ImGui.set_function("SetTaskSlice"					, SetTaskSlice);
+		ImGui.set_function("GetTaskStats"					, GetTaskStats);
+	}
+
+	void Sync(const std::vector<lua_State*>& live, const std::vector<lua_State*>& removed) {
+		g_Live = live;
+		std::erase_if(g_Tasks, [&](const Task& task) {
+			return std::find(removed.begin(), removed.end(), task.L) != removed.end();
+		});
+		g_Next = 0;
+	}
+
+	void Run() {
+		g_UsedMs = 0;
+		if (g_Tasks.empty())
+			return;
+		const auto start = Clock::now();
+		g_Deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(g_SliceMs));
+
+		// Each task gets one turn, starting where the last frame stopped
+		size_t turns = g_Tasks.size();
+		if (g_Next >= g_Tasks.size())
+			g_Next = 0;
+		while (turns-- > 0 && !g_Tasks.empty() && Clock::now() < g_Deadline) {
+			Task task = g_Tasks[g_Next];
+			// A stopped script's state is not ours to resume
+			if (!Live(task)) {
+				g_Next = (g_Next + 1) % g_Tasks.size();
+				continue;
+			}
+			g_Current = task.co;
+			int nres = 0;
+			const int status = lua_resume(task.co, task.L, task.started ? 0 : task.nargs, &nres);
+			g_Current = nullptr;
+			g_Resumes++;
+
+			if (status == LUA_YIELD) {
+				lua_pop(task.co, nres);
+				g_Tasks[g_Next].started = true;
+				g_Next = (g_Next + 1) % g_Tasks.size();
+				continue;
+			}
+			// Spawn may have added tasks meanwhile, so erase by position before touching the list again
+			g_Tasks.erase(g_Tasks.begin() + g_Next);
+			if (g_Next >= g_Tasks.size())
+				g_Next = 0;
+			Finish(task, status, nres);
+		}
+
+		g_UsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		g_TotalUsedMs += g_UsedMs;
+		g_Frames++;
+	}
+
+	size_t Pending() {
+		return static_cast<size_t>(std::count_if(g_Tasks.begin(), g_Tasks.end(), Live));
+	}
+
+}
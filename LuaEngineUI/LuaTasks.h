@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <sol/sol.hpp>
+
+// Background work for scripts, run as coroutines in a per-frame time slice after all on_imgui
+// calls. Each task is resumed at most once per frame; it gives up its turn with coroutine.yield(),
+// or is suspended for it once the slice is over (when it is not inside a C call). The returned
+// handle is filled in when the task ends.
+//
+//	local scan = ImGui.Spawn(function(list)
+//		local n = 0
+//		for i, e in ipairs(list) do n = n + e.hp; if i % 100 == 0 then coroutine.yield() end end
+//		return n
+//	end, entities)
+//	if scan.done then ImGui.Text(scan.ok and ("total " .. scan.result) or scan.error) end
+namespace LuaTasks {
+
+	// Adds ImGui.Spawn/SetTaskSlice/GetTaskStats. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Takes the started script states (LuaUI::Changes::live) and drops the tasks of states in
+	// `removed`, which are never touched. Tasks of a state that is stopped but still open are kept
+	// and sit out until it is started again.
+	void Sync(const std::vector<lua_State*>& live, const std::vector<lua_State*>& removed);
+
+	// Resumes tasks of live states until the slice is used up. Call after the on_imgui pass.
+	void Run();
+
+	// Tasks of live states that have not finished yet.
+	size_t Pending();
+
+}
@@ -0,0 +1,137 @@
+#include "LuaUI.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "loader.h"
+#include "lua_core.h"
+#include "FrameBudget.h"
+#include "ScriptProfiler.h"
+
+namespace LuaUI {
+
+	struct Callback {
+		lua_State* L;
+		int ref;
+		std::string name;
+		ScriptProfiler::Series* series;
+	};
+
+	// A state we have bound, identified by address plus the generation stamped into its registry
+	struct Bound {
+		lua_State* L;
+		lua_Integer generation;
+	};
+
+	static std::shared_ptr<const Registry> g_Registry;
+	static bool g_Stale = true;
+	static std::vector<Bound> g_Bound;
+	static lua_Integer g_NextGeneration = 1;
+	static Changes g_Changes;
+	static std::vector<Callback> g_Callbacks;
+	static const char g_GenerationKey = 0;
+
+	static lua_Integer GetGeneration(lua_State* L) {
+		lua_rawgetp(L, LUA_REGISTRYINDEX, &g_GenerationKey);
+		lua_Integer generation = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+		return generation;
+	}
+
+	static int Traceback(lua_State* L) {
+		luaL_traceback(L, L, lua_tostring(L, 1), 1);
+		return 1;
+	}
+
+	std::shared_ptr<const Registry> Scripts() {
+		if (!g_Registry || g_Stale) {
+			auto registry = std::make_shared<Registry>();
+			registry->version = g_Registry ? g_Registry->version + 1 : 1;
+			for (const auto& [file, luae] : LuaCore::getLuas()) {
+				if (luae.L)
+					registry->scripts.push_back({ luae.L, luae.start, luae.name.empty() ? file : luae.name });
+			}
+			g_Registry = std::move(registry);
+			g_Stale = false;
+		}
+		return g_Registry;
+	}
+
+	void Invalidate() {
+		g_Stale = true;
+	}
+
+	const Changes& Refresh() {
+		const auto registry = Scripts();
+		const auto& scripts = registry->scripts;
+		g_Changes.live.clear();
+		g_Changes.added.clear();
+		g_Changes.removed.clear();
+
+		// Gone, or replaced by a new state at the same address. Neither may be touched.
+		std::erase_if(g_Bound, [&](const Bound& bound) {
+			bool present = std::any_of(scripts.begin(), scripts.end(), [&](const Script& script) { return script.L == bound.L; });
+			if (present && GetGeneration(bound.L) == bound.generation)
+				return false;
+			g_Changes.removed.push_back(bound.L);
+			return true;
+		});
+
+		for (const Callback& callback : g_Callbacks) {
+			if (std::find(g_Changes.removed.begin(), g_Changes.removed.end(), callback.L) == g_Changes.removed.end())
+				luaL_unref(callback.L, LUA_REGISTRYINDEX, callback.ref);
+		}
+		g_Callbacks.clear();
+
+		for (const Script& script : scripts) {
+			if (!script.started)
+				continue;
+			lua_State* L = script.L;
+			g_Changes.live.push_back(L);
+			if (std::none_of(g_Bound.begin(), g_Bound.end(), [L](const Bound& bound) { return bound.L == L; })) {
+				const lua_Integer generation = g_NextGeneration++;
+				lua_pushinteger(L, generation);
+				lua_rawsetp(L, LUA_REGISTRYINDEX, &g_GenerationKey);
+				g_Bound.push_back({ L, generation });
+				g_Changes.added.push_back(L);
+			}
+
+			// Re-resolved for every state: a reload may re-run a script in the state it already had
+			lua_getglobal(L, "on_imgui");
+			if (lua_isfunction(L, -1))
+				g_Callbacks.push_back({ L, luaL_ref(L, LUA_REGISTRYINDEX), script.name, ScriptProfiler::Get(script.name) });
+			else
+				lua_pop(L, 1);
+		}
+		return g_Changes;
+	}
+
+	void Run() {
+		const bool profile = ScriptProfiler::Enabled();
+		FrameBudget::BeginFrame();
+		for (const Callback& callback : g_Callbacks) {
+			lua_State* L = callback.L;
+			if (!FrameBudget::ShouldRun(L))
+				continue;
+			const auto start = std::chrono::steady_clock::now();
+			ScriptProfiler::Probe probe{};
+			if (profile)
+				probe = ScriptProfiler::Begin(L);
+			// A light C function, so pushing the handler allocates nothing
+			lua_pushcfunction(L, Traceback);
+			lua_rawgeti(L, LUA_REGISTRYINDEX, callback.ref);
+			if (lua_pcall(L, 0, 0, -2) != LUA_OK) {
+				const char* error = lua_tostring(L, -1);
+				loader::LOG(loader::ERR) << "[LuaEngineUI] " << callback.name << ": on_imgui: " << (error ? error : "(non-string error)");
+				lua_pop(L, 1);
+			}
+			lua_pop(L, 1);
+			if (profile)
+				ScriptProfiler::End(probe, callback.series);
+			FrameBudget::Ran(L, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		FrameBudget::EndFrame();
+	}
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <sol/sol.hpp>
+
+// Per-frame driver for the scripts' on_imgui callbacks. Each script's on_imgui is resolved to
+// a registry reference once per load or reload, then called straight from a flat array.
+namespace LuaUI {
+
+	struct Script {
+		lua_State* L;
+		bool started;
+		std::string name;
+	};
+
+	// Immutable copy of LuaEngine's script registry. A new one is only built after Invalidate().
+	struct Registry {
+		uint64_t version;
+		std::vector<Script> scripts;
+	};
+
+	// Current snapshot. Costs one LuaCore::getLuas() call after an invalidation, nothing otherwise.
+	std::shared_ptr<const Registry> Scripts();
+
+	// Marks the snapshot stale; call when LuaCore::reloadTime changes.
+	void Invalidate();
+
+	// What a Refresh found: started states, states seen for the first time (to be bound), and
+	// states that went away or were replaced by a new state at the same address (not to be touched).
+	struct Changes {
+		std::vector<lua_State*> live;
+		std::vector<lua_State*> added;
+		std::vector<lua_State*> removed;
+	};
+
+	// Diffs the snapshot against the states bound so far, by address and a generation number
+	// stamped into each state's registry, and re-resolves every started script's on_imgui.
+	// Call after each load or reload; a script that assigns on_imgui later is picked up on its
+	// next reload.
+	const Changes& Refresh();
+
+	// Calls every cached on_imgui that FrameBudget says is due this frame.
+	void Run();
+
+}
@@ -0,0 +1,160 @@
+#include "Mipmaps.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MIPMAPS_SSE2
+#endif
+
+namespace Mipmaps {
+
+	// Linear values are quantized this finely on the way back to sRGB; coarser tables band the
+	// darks, where the curve is steepest
+	constexpr int kEncodeSize = 8192;
+
+	static float g_ToLinear[256];
+	static uint8_t g_ToSrgb[kEncodeSize];
+	static std::once_flag g_Tables;
+
+	static void BuildTables() {
+		for (int i = 0; i < 256; i++) {
+			const float c = i / 255.0f;
+			g_ToLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+		}
+		for (int i = 0; i < kEncodeSize; i++) {
+			const float l = i / float(kEncodeSize - 1);
+			const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+			g_ToSrgb[i] = static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
+		}
+	}
+
+#ifdef MIPMAPS_SSE2
+	// One texel as (r, g, b, 1) in linear light
+	static inline __m128 Load(const uint8_t* p) {
+		return _mm_set_ps(1.0f, g_ToLinear[p[2]], g_ToLinear[p[1]], g_ToLinear[p[0]]);
+	}
+
+	static inline __m128 Alpha(const uint8_t* p) {
+		return _mm_set1_ps(p[3] * (1.0f / 255.0f));
+	}
+
+	// Averages the 2x2 texels at a, b (one row) and c, d (the next) into out
+	static inline void FilterSse2(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* out) {
+		const __m128 la = Load(a), lb = Load(b), lc = Load(c), ld = Load(d);
+		const __m128 wa = Alpha(a), wb = Alpha(b), wc = Alpha(c), wd = Alpha(d);
+		// (r*a, g*a, b*a, a) summed; lane 3 is the total alpha
+		const __m128 weighted = _mm_add_ps(_mm_add_ps(_mm_mul_ps(la, wa), _mm_mul_ps(lb, wb)), _mm_add_ps(_mm_mul_ps(lc, wc), _mm_mul_ps(ld, wd)));
+		const float alpha = _mm_cvtss_f32(_mm_shuffle_ps(weighted, weighted, _MM_SHUFFLE(3, 3, 3, 3)));
+
+		__m128 color;
+		if (alpha > 0.0f)
+			color = _mm_div_ps(weighted, _mm_shuffle_ps(weighted, weighted, _MM_SHUFFLE(3, 3, 3, 3)));
+		else
+			// Fully transparent: keep the plain average so filtering into it stays sensible
+			color = _mm_mul_ps(_mm_add_ps(_mm_add_ps(la, lb), _mm_add_ps(lc, ld)), _mm_set1_ps(0.25f));
+
+		const __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(color, _mm_set1_ps(kEncodeSize - 1.0f)), _mm_set1_ps(0.5f)), _mm_setzero_ps()), _mm_set1_ps(kEncodeSize - 1.0f));
+		alignas(16) int32_t index[4];
+		_mm_store_si128(reinterpret_cast<__m128i*>(index), _mm_cvttps_epi32(scaled));
+		out[0] = g_ToSrgb[index[0]];
+		out[1] = g_ToSrgb[index[1]];
+		out[2] = g_ToSrgb[index[2]];
+		out[3] = static_cast<uint8_t>(alpha * (255.0f / 4.0f) + 0.5f);
+	}
+#endif
+
+	static inline void FilterScalar(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* out) {
+		const uint8_t* texels[4] = { a, b, c, d };
+		float weighted[3] = {};
+		float plain[3] = {};
+		float alpha = 0.0f;
+		for (const uint8_t* p : texels) {
+			const float w = p[3] * (1.0f / 255.0f);
+			for (int i = 0; i < 3; i++) {
+				weighted[i] += g_ToLinear[p[i]] * w;
+				plain[i] += g_ToLinear[p[i]];
+			}
+			alpha += w;
+		}
+		for (int i = 0; i < 3; i++) {
+			const float color = alpha > 0.0f ? weighted[i] / alpha : plain[i] * 0.25f;
+			out[i] = g_ToSrgb[static_cast<int>(std::clamp(color * (kEncodeSize - 1.0f) + 0.5f, 0.0f, kEncodeSize - 1.0f))];
+		}
+		out[3] = static_cast<uint8_t>(alpha * (255.0f / 4.0f) + 0.5f);
+	}
+
+	using FilterFn = void(*)(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* out);
+
+	// The filter is a template argument so it inlines into the loop
+	template <FilterFn Filter>
+	static void Downsample(const uint8_t* src, int srcWidth, int srcHeight, uint8_t* dst, int dstWidth, int dstHeight) {
+		const size_t srcPitch = static_cast<size_t>(srcWidth) * 4;
+		for (int y = 0; y < dstHeight; y++) {
+			const uint8_t* row0 = src + static_cast<size_t>(y * 2) * srcPitch;
+			const uint8_t* row1 = src + static_cast<size_t>(std::min(y * 2 + 1, srcHeight - 1)) * srcPitch;
+			uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+			for (int x = 0; x < dstWidth; x++) {
+				const size_t x0 = static_cast<size_t>(x * 2) * 4;
+				const size_t x1 = static_cast<size_t>(std::min(x * 2 + 1, srcWidth - 1)) * 4;
+				Filter(row0 + x0, row0 + x1, row1 + x0, row1 + x1, out + x * 4);
+			}
+		}
+	}
+
+	int Count(int width, int height) {
+		int levels = 1;
+		for (int extent = std::max(width, height); extent > 1; extent >>= 1)
+			levels++;
+		return levels;
+	}
+
+	bool HasSse2() {
+#ifdef MIPMAPS_SSE2
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	bool Generate(TextureLoader::Image& image) {
+		return Generate(image, HasSse2() ? Kernel::Sse2 : Kernel::Scalar);
+	}
+
+	bool Generate(TextureLoader::Image& image, Kernel kernel) {
+		if (kernel == Kernel::Sse2 && !HasSse2())
+			return false;
+		if (image.format != TextureLoader::Format::RGBA8 || image.mips != 1 || image.width <= 0 || image.height <= 0)
+			return false;
+		std::call_once(g_Tables, BuildTables);
+
+		const int levels = Count(image.width, image.height);
+		size_t total = 0;
+		for (int level = 0; level < levels; level++)
+			total += TextureLoader::LevelSize(image.format, TextureLoader::MipExtent(image.width, level), TextureLoader::MipExtent(image.height, level));
+		image.pixels.resize(total);
+
+		size_t offset = 0;
+		for (int level = 1; level < levels; level++) {
+			const int srcWidth = TextureLoader::MipExtent(image.width, level - 1);
+			const int srcHeight = TextureLoader::MipExtent(image.height, level - 1);
+			const size_t next = offset + TextureLoader::LevelSize(image.format, srcWidth, srcHeight);
+			const uint8_t* src = image.pixels.data() + offset;
+			uint8_t* dst = image.pixels.data() + next;
+			const int dstWidth = TextureLoader::MipExtent(image.width, level);
+			const int dstHeight = TextureLoader::MipExtent(image.height, level);
+#ifdef MIPMAPS_SSE2
+			if (kernel == Kernel::Sse2)
+				Downsample<FilterSse2>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight);
+			else
+#endif
+				Downsample<FilterScalar>(src, srcWidth, srcHeight, dst, dstWidth, dstHeight);
+			offset = next;
+		}
+		image.mips = levels;
+		return true;
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "TextureLoader.h"
+
+// Mip chains for decoded RGBA8 images, built on the CPU at load time. Each level is a 2x2 box
+// filter of the one above it, averaged in linear light (the pixels are taken as sRGB) and weighted
+// by alpha, so dark fringes don't bleed in from transparent texels. Odd edges drop their last
+// row or column, like D3DX does.
+namespace Mipmaps {
+
+	// The 2x2 filter behind each level. Generate uses SSE2 where the build targets it; the scalar
+	// one is always there too, so tests and the bench can hold the two against each other.
+	enum class Kernel : uint8_t {
+		Scalar,
+		Sse2,
+	};
+	bool HasSse2();
+
+	// Appends the levels below the top one to `image`. Images that are compressed or already have
+	// mips are left alone; returns whether the image has a full chain afterwards.
+	bool Generate(TextureLoader::Image& image);
+	// The same with a given kernel. False without building anything for Sse2 when !HasSse2().
+	bool Generate(TextureLoader::Image& image, Kernel kernel);
+
+	// Number of levels of a full chain down to 1x1
+	int Count(int width, int height);
+
+}
@@ -0,0 +1,82 @@
+#include "RectPacker.h"
+#include <algorithm>
+#include <climits>
+
+namespace RectPacker {
+
+	void Skyline::Reset(int width, int height) {
+		this->width = width;
+		this->height = height;
+		area = 0;
+		nodes.assign(1, { 0, 0, width });
+	}
+
+	bool Skyline::Fit(size_t index, int w, int h, int& y) const {
+		if (nodes[index].x + w > width)
+			return false;
+		y = 0;
+		int left = w;
+		for (size_t i = index; left > 0; i++) {
+			if (i == nodes.size())
+				return false;
+			y = std::max(y, nodes[i].y);
+			if (y + h > height)
+				return false;
+			left -= nodes[i].width;
+		}
+		return true;
+	}
+
+	bool Skyline::Insert(int w, int h, int& x, int& y) {
+		if (w <= 0 || h <= 0)
+			return false;
+		size_t best = nodes.size();
+		int bestTop = INT_MAX;
+		for (size_t i = 0; i < nodes.size(); i++) {
+			int top;
+			// Ties go to the leftmost position, which comes first
+			if (Fit(i, w, h, top) && top + h < bestTop) {
+				best = i;
+				bestTop = top + h;
+				y = top;
+			}
+		}
+		if (best == nodes.size())
+			return false;
+		x = nodes[best].x;
+
+		nodes.insert(nodes.begin() + best, { x, y + h, w });
+		// Cut the segments the new one now covers
+		for (size_t i = best + 1; i < nodes.size();) {
+			const Node& prev = nodes[i - 1];
+			Node& node = nodes[i];
+			const int overlap = prev.x + prev.width - node.x;
+			if (overlap <= 0)
+				break;
+			node.x += overlap;
+			node.width -= overlap;
+			if (node.width > 0)
+				break;
+			nodes.erase(nodes.begin() + i);
+		}
+		// Merge neighbours at the same height
+		for (size_t i = 0; i + 1 < nodes.size();) {
+			if (nodes[i].y == nodes[i + 1].y) {
+				nodes[i].width += nodes[i + 1].width;
+				nodes.erase(nodes.begin() + i + 1);
+			}
+			else {
+				i++;
+			}
+		}
+		area += static_cast<int64_t>(w) * h;
+		return true;
+	}
+
+	float Skyline::Occupancy() const {
+		if (width <= 0 || height <= 0)
+			return 0.0f;
+		return static_cast<float>(static_cast<double>(area) / (static_cast<double>(width) * height));
+	}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Skyline bottom-left rectangle packer. Rects are placed where their top ends up lowest, which
+// keeps the free area in one piece for icons of mixed sizes. Space is never given back.
+namespace RectPacker {
+
+	struct Skyline {
+		void Reset(int width, int height);
+		// Position for a w x h rect, or false when it doesn't fit anywhere.
+		bool Insert(int w, int h, int& x, int& y);
+		// Share of the area covered by inserted rects
+		float Occupancy() const;
+
+	private:
+		// A horizontal segment of the skyline
+		struct Node {
+			int x;
+			int y;
+			int width;
+		};
+
+		// Lowest top edge for a w x h rect resting on the skyline from node `index`
+		bool Fit(size_t index, int w, int h, int& y) const;
+
+		std::vector<Node> nodes;
+		int width = 0;
+		int height = 0;
+		int64_t area = 0;
+	};
+
+}
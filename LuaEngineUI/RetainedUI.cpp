@@ -0,0 +1,463 @@
+#include "RetainedUI.h"
+#include <imgui.h>
+#include <algorithm>
+#include <cfloat>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "loader.h"
+#include "TextureCache.h"
+
+namespace RetainedUI {
+
+	enum class Op : uint8_t {
+		Begin,
+		End,
+		CollapsingHeader,
+		TreeNode,
+		TreePop,
+		Text,
+		TextColored,
+		TextWrapped,
+		BulletText,
+		Separator,
+		SameLine,
+		Spacing,
+		NewLine,
+		Button,
+		SmallButton,
+		Checkbox,
+		SliderFloat,
+		SliderInt,
+		DragFloat,
+		ProgressBar,
+		Image,
+	};
+
+	// One widget. Strings live in Panel::strings, containers jump to `skip` when closed.
+	struct Command {
+		Op op;
+		bool hidden = false;
+		bool closable = false;
+		int flags = 0;
+		int label = -1;
+		int format = -1;
+		uint32_t skip = 0;
+		int callback = LUA_NOREF;
+		float v[4] = {};
+		uintptr_t texture = 0;
+	};
+
+	struct Panel {
+		int handle = 0;
+		lua_State* L = nullptr;
+		int tree = LUA_NOREF;
+		bool dirty = false;
+		bool removed = false;
+		// Removed from one of its own callbacks; dropped after the frame so its windows still close
+		bool closing = false;
+		std::vector<Command> commands;
+		std::vector<std::string> strings;
+		std::vector<int> callbacks;
+		std::unordered_map<std::string, uint32_t> ids;
+	};
+
+	static std::vector<std::unique_ptr<Panel>> g_Panels;
+	static int g_NextHandle = 1;
+
+	static const std::unordered_map<std::string, Op> g_OpNames = {
+		{ "Window",				Op::Begin },
+		{ "CollapsingHeader",	Op::CollapsingHeader },
+		{ "TreeNode",			Op::TreeNode },
+		{ "Text",				Op::Text },
+		{ "TextColored",		Op::TextColored },
+		{ "TextWrapped",		Op::TextWrapped },
+		{ "BulletText",			Op::BulletText },
+		{ "Separator",			Op::Separator },
+		{ "SameLine",			Op::SameLine },
+		{ "Spacing",			Op::Spacing },
+		{ "NewLine",			Op::NewLine },
+		{ "Button",				Op::Button },
+		{ "SmallButton",		Op::SmallButton },
+		{ "Checkbox",			Op::Checkbox },
+		{ "SliderFloat",		Op::SliderFloat },
+		{ "SliderInt",			Op::SliderInt },
+		{ "DragFloat",			Op::DragFloat },
+		{ "ProgressBar",		Op::ProgressBar },
+		{ "Image",				Op::Image },
+	};
+
+	static Panel* FindPanel(lua_State* L, int handle) {
+		for (auto& panel : g_Panels) {
+			if (panel->handle == handle && panel->L == L && !panel->removed && !panel->closing)
+				return panel.get();
+		}
+		return nullptr;
+	}
+
+	static void ReleaseRefs(Panel& panel) {
+		for (int ref : panel.callbacks)
+			luaL_unref(panel.L, LUA_REGISTRYINDEX, ref);
+		panel.callbacks.clear();
+	}
+
+	static int AddString(Panel& panel, const std::string& str) {
+		panel.strings.push_back(str);
+		return static_cast<int>(panel.strings.size() - 1);
+	}
+
+	static int AddCallback(Panel& panel, const sol::table& node, const char* key) {
+		sol::object fn = node[key];
+		if (fn.get_type() != sol::type::function)
+			return LUA_NOREF;
+		fn.push(panel.L);
+		int ref = luaL_ref(panel.L, LUA_REGISTRYINDEX);
+		panel.callbacks.push_back(ref);
+		return ref;
+	}
+
+	static void CompileNode(Panel& panel, const sol::table& node);
+
+	static void CompileChildren(Panel& panel, const sol::table& node) {
+		sol::optional<sol::table> children = node["children"];
+		if (!children)
+			return;
+		for (size_t i = 1; i <= children->size(); i++) {
+			sol::optional<sol::table> child = (*children)[i];
+			if (child)
+				CompileNode(panel, *child);
+		}
+	}
+
+	static void CompileNode(Panel& panel, const sol::table& node) {
+		std::string type = node.get_or<std::string>("type", "");
+		auto it = g_OpNames.find(type);
+		if (it == g_OpNames.end()) {
+			loader::LOG(loader::WARN) << "[LuaEngineUI] Retained: unknown node type '" << type << "'";
+			return;
+		}
+
+		Command cmd;
+		cmd.op = it->second;
+		cmd.flags = node.get_or("flags", 0);
+		if (cmd.op == Op::Text || cmd.op == Op::TextColored || cmd.op == Op::TextWrapped || cmd.op == Op::BulletText)
+			cmd.label = AddString(panel, node.get_or<std::string>("text", node.get_or<std::string>("label", "")));
+		else
+			cmd.label = AddString(panel, node.get_or<std::string>("label", type));
+
+		switch (cmd.op) {
+		case Op::Begin:
+			cmd.closable = node.get_or("closable", false);
+			cmd.hidden = !node.get_or("visible", true);
+			cmd.callback = AddCallback(panel, node, "on_close");
+			break;
+		case Op::TextColored: {
+			sol::optional<sol::table> color = node["color"];
+			for (int c = 0; c < 4; c++)
+				cmd.v[c] = color ? (*color).get_or(c + 1, 1.0f) : 1.0f;
+			break;
+		}
+		case Op::SameLine:
+			cmd.v[0] = node.get_or("offset", 0.0f);
+			cmd.v[1] = node.get_or("spacing", -1.0f);
+			break;
+		case Op::Button:
+		case Op::SmallButton:
+			cmd.v[0] = node.get_or("width", 0.0f);
+			cmd.v[1] = node.get_or("height", 0.0f);
+			cmd.callback = AddCallback(panel, node, "on_click");
+			break;
+		case Op::Checkbox:
+			cmd.v[0] = node.get_or("value", false) ? 1.0f : 0.0f;
+			cmd.callback = AddCallback(panel, node, "on_change");
+			break;
+		case Op::SliderFloat:
+		case Op::SliderInt:
+		case Op::DragFloat:
+			cmd.v[0] = node.get_or("value", 0.0f);
+			cmd.v[1] = node.get_or("min", 0.0f);
+			cmd.v[2] = node.get_or("max", cmd.op == Op::DragFloat ? 0.0f : 1.0f);
+			cmd.v[3] = node.get_or("speed", 1.0f);
+			cmd.format = AddString(panel, node.get_or<std::string>("format", cmd.op == Op::SliderInt ? "%d" : "%.3f"));
+			cmd.callback = AddCallback(panel, node, "on_change");
+			break;
+		case Op::ProgressBar:
+			cmd.v[0] = node.get_or("value", 0.0f);
+			cmd.v[1] = node.get_or("width", -FLT_MIN);
+			cmd.v[2] = node.get_or("height", 0.0f);
+			break;
+		case Op::Image:
+			cmd.texture = static_cast<uintptr_t>(node.get_or<long long>("texture", 0));
+			cmd.v[0] = node.get_or("width", 0.0f);
+			cmd.v[1] = node.get_or("height", 0.0f);
+			break;
+		default:
+			break;
+		}
+
+		sol::optional<std::string> id = node["id"];
+		uint32_t index = static_cast<uint32_t>(panel.commands.size());
+		if (id)
+			panel.ids[*id] = index;
+		panel.commands.push_back(cmd);
+
+		if (cmd.op == Op::Begin || cmd.op == Op::CollapsingHeader || cmd.op == Op::TreeNode) {
+			CompileChildren(panel, node);
+			if (cmd.op == Op::Begin || cmd.op == Op::TreeNode) {
+				Command close;
+				close.op = cmd.op == Op::Begin ? Op::End : Op::TreePop;
+				panel.commands.push_back(close);
+			}
+			panel.commands[index].skip = static_cast<uint32_t>(panel.commands.size());
+		}
+	}
+
+	static void Compile(Panel& panel) {
+		ReleaseRefs(panel);
+		panel.commands.clear();
+		panel.strings.clear();
+		panel.ids.clear();
+
+		lua_rawgeti(panel.L, LUA_REGISTRYINDEX, panel.tree);
+		sol::table root(panel.L, -1);
+		lua_pop(panel.L, 1);
+
+		if (root["type"].valid()) {
+			CompileNode(panel, root);
+		}
+		else {
+			for (size_t i = 1; i <= root.size(); i++) {
+				sol::optional<sol::table> node = root[i];
+				if (node)
+					CompileNode(panel, *node);
+			}
+		}
+		panel.dirty = false;
+	}
+
+	static int Traceback(lua_State* L) {
+		luaL_traceback(L, L, lua_tostring(L, 1), 1);
+		return 1;
+	}
+
+	template<typename... Args>
+	static void Invoke(Panel& panel, int callback, Args... args) {
+		if (callback == LUA_NOREF || panel.closing)
+			return;
+		lua_State* L = panel.L;
+		lua_pushcfunction(L, Traceback);
+		lua_rawgeti(L, LUA_REGISTRYINDEX, callback);
+		(sol::stack::push(L, args), ...);
+		if (lua_pcall(L, sizeof...(Args), 0, -static_cast<int>(sizeof...(Args)) - 2) != LUA_OK) {
+			const char* error = lua_tostring(L, -1);
+			loader::LOG(loader::ERR) << "[LuaEngineUI] Retained callback error: " << (error ? error : "(non-string error)");
+			lua_pop(L, 1);
+		}
+		lua_pop(L, 1);
+	}
+
+	// Textures are script handles; one still loading keeps its place
+	static void Image(uintptr_t texture, const ImVec2& size) {
+		ImTextureID id;
+		ImVec4 uv;
+		if (TextureCache::Resolve(static_cast<long long>(texture), size, id, uv))
+			ImGui::Image(id, size, ImVec2(uv.x, uv.y), ImVec2(uv.z, uv.w));
+		else
+			ImGui::Dummy(size);
+	}
+
+	static void Replay(Panel& panel) {
+		auto& cmds = panel.commands;
+		for (size_t i = 0; i < cmds.size(); i++) {
+			Command& c = cmds[i];
+			const char* label = c.label >= 0 ? panel.strings[c.label].c_str() : "";
+			switch (c.op) {
+			case Op::Begin: {
+				if (c.hidden) {
+					i = c.skip - 1;
+					break;
+				}
+				bool open = true;
+				bool visible = ImGui::Begin(label, c.closable ? &open : nullptr, c.flags);
+				if (!open) {
+					c.hidden = true;
+					Invoke(panel, c.callback, false);
+				}
+				if (!visible || !open) {
+					ImGui::End();
+					i = c.skip - 1;
+				}
+				break;
+			}
+			case Op::End:				ImGui::End(); break;
+			case Op::CollapsingHeader:
+				if (!ImGui::CollapsingHeader(label, c.flags))
+					i = c.skip - 1;
+				break;
+			case Op::TreeNode:
+				if (!ImGui::TreeNodeEx(label, c.flags))
+					i = c.skip - 1;
+				break;
+			case Op::TreePop:			ImGui::TreePop(); break;
+			case Op::Text:				ImGui::TextUnformatted(label); break;
+			case Op::TextColored:		ImGui::TextColored({ c.v[0], c.v[1], c.v[2], c.v[3] }, "%s", label); break;
+			case Op::TextWrapped:		ImGui::TextWrapped("%s", label); break;
+			case Op::BulletText:		ImGui::BulletText("%s", label); break;
+			case Op::Separator:			ImGui::Separator(); break;
+			case Op::SameLine:			ImGui::SameLine(c.v[0], c.v[1]); break;
+			case Op::Spacing:			ImGui::Spacing(); break;
+			case Op::NewLine:			ImGui::NewLine(); break;
+			case Op::Button:
+				if (ImGui::Button(label, { c.v[0], c.v[1] }))
+					Invoke(panel, c.callback);
+				break;
+			case Op::SmallButton:
+				if (ImGui::SmallButton(label))
+					Invoke(panel, c.callback);
+				break;
+			case Op::Checkbox: {
+				bool value = c.v[0] != 0.0f;
+				if (ImGui::Checkbox(label, &value)) {
+					c.v[0] = value ? 1.0f : 0.0f;
+					Invoke(panel, c.callback, value);
+				}
+				break;
+			}
+			case Op::SliderFloat:
+				if (ImGui::SliderFloat(label, &c.v[0], c.v[1], c.v[2], panel.strings[c.format].c_str(), c.flags))
+					Invoke(panel, c.callback, c.v[0]);
+				break;
+			case Op::SliderInt: {
+				int value = static_cast<int>(c.v[0]);
+				if (ImGui::SliderInt(label, &value, static_cast<int>(c.v[1]), static_cast<int>(c.v[2]), panel.strings[c.format].c_str(), c.flags)) {
+					c.v[0] = static_cast<float>(value);
+					Invoke(panel, c.callback, value);
+				}
+				break;
+			}
+			case Op::DragFloat:
+				if (ImGui::DragFloat(label, &c.v[0], c.v[3], c.v[1], c.v[2], panel.strings[c.format].c_str(), c.flags))
+					Invoke(panel, c.callback, c.v[0]);
+				break;
+			case Op::ProgressBar:		ImGui::ProgressBar(c.v[0], { c.v[1], c.v[2] }); break;
+			case Op::Image:				Image(c.texture, { c.v[0], c.v[1] }); break;
+			}
+		}
+	}
+
+	static void Drop(Panel& panel, bool alive) {
+		if (alive) {
+			ReleaseRefs(panel);
+			luaL_unref(panel.L, LUA_REGISTRYINDEX, panel.tree);
+		}
+		panel.removed = true;
+	}
+
+	static int Submit(sol::this_state s, sol::table tree) {
+		auto panel = std::make_unique<Panel>();
+		panel->handle = g_NextHandle++;
+		panel->L = s;
+		tree.push(s);
+		panel->tree = luaL_ref(s, LUA_REGISTRYINDEX);
+		Compile(*panel);
+		g_Panels.push_back(std::move(panel));
+		return g_Panels.back()->handle;
+	}
+
+	static bool Set(sol::this_state s, int handle, const std::string& id, sol::object value) {
+		Panel* panel = FindPanel(s, handle);
+		if (!panel)
+			return false;
+		auto it = panel->ids.find(id);
+		if (it == panel->ids.end())
+			return false;
+
+		Command& c = panel->commands[it->second];
+		switch (value.get_type()) {
+		case sol::type::string:
+			panel->strings[c.label] = value.as<std::string>();
+			break;
+		case sol::type::boolean:
+			if (c.op == Op::Begin)
+				c.hidden = !value.as<bool>();
+			else
+				c.v[0] = value.as<bool>() ? 1.0f : 0.0f;
+			break;
+		case sol::type::number:
+			if (c.op == Op::Image)
+				c.texture = static_cast<uintptr_t>(value.as<long long>());
+			else
+				c.v[0] = value.as<float>();
+			break;
+		default:
+			return false;
+		}
+		return true;
+	}
+
+	static sol::object Get(sol::this_state s, int handle, const std::string& id) {
+		Panel* panel = FindPanel(s, handle);
+		if (!panel)
+			return sol::make_object(s, sol::lua_nil);
+		auto it = panel->ids.find(id);
+		if (it == panel->ids.end())
+			return sol::make_object(s, sol::lua_nil);
+
+		const Command& c = panel->commands[it->second];
+		switch (c.op) {
+		case Op::Begin:			return sol::make_object(s, !c.hidden);
+		case Op::Checkbox:		return sol::make_object(s, c.v[0] != 0.0f);
+		case Op::SliderInt:		return sol::make_object(s, static_cast<int>(c.v[0]));
+		case Op::SliderFloat:
+		case Op::DragFloat:
+		case Op::ProgressBar:	return sol::make_object(s, c.v[0]);
+		default:				return sol::make_object(s, panel->strings[c.label]);
+		}
+	}
+
+	static void Dirty(sol::this_state s, int handle) {
+		if (Panel* panel = FindPanel(s, handle))
+			panel->dirty = true;
+	}
+
+	static void Remove(sol::this_state s, int handle) {
+		// Usually called from the panel's own callback, mid-replay with windows still open
+		if (Panel* panel = FindPanel(s, handle))
+			panel->closing = true;
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("Retained"						, Submit);
+		ImGui.set_function("RetainedSet"					, Set);
+		ImGui.set_function("RetainedGet"					, Get);
+		ImGui.set_function("RetainedDirty"					, Dirty);
+		ImGui.set_function("RetainedRemove"					, Remove);
+	}
+
+	void Forget(const std::vector<lua_State*>& removed) {
+		for (auto& panel : g_Panels) {
+			if (std::find(removed.begin(), removed.end(), panel->L) != removed.end())
+				Drop(*panel, false);
+		}
+		std::erase_if(g_Panels, [](const auto& panel) { return panel->removed; });
+	}
+
+	void Render() {
+		for (size_t i = 0; i < g_Panels.size(); i++) {
+			Panel& panel = *g_Panels[i];
+			if (panel.removed || panel.closing)
+				continue;
+			if (panel.dirty)
+				Compile(panel);
+			Replay(panel);
+		}
+		for (auto& panel : g_Panels) {
+			if (panel->closing && !panel->removed)
+				Drop(*panel, true);
+		}
+		std::erase_if(g_Panels, [](const auto& panel) { return panel->removed; });
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+#include <sol/sol.hpp>
+
+// Retained-mode panels: a script submits a declarative widget tree once, it is compiled
+// into a flat command buffer and replayed every frame without entering Lua. Lua is only
+// called back for widgets the user interacted with.
+//
+//	local panel = ImGui.Retained({ type = "Window", label = "Stats", children = {
+//		{ type = "Text", id = "hp", text = "HP: 0" },
+//		{ type = "Button", label = "Reset", on_click = function() ... end },
+//	} })
+//	ImGui.RetainedSet(panel, "hp", "HP: 100")	-- patch a node in place
+//	ImGui.RetainedDirty(panel)					-- recompile after editing the table
+namespace RetainedUI {
+
+	// Adds ImGui.Retained/RetainedSet/RetainedGet/RetainedDirty/RetainedRemove. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Forgets panels owned by states that went away or were replaced (LuaUI::Changes::removed).
+	// Those states are never touched.
+	void Forget(const std::vector<lua_State*>& removed);
+
+	// Replays every retained panel. Call between ImGui::NewFrame() and ImGui::Render().
+	void Render();
+
+}
@@ -0,0 +1,276 @@
+#include "ScriptProfiler.h"
+#include <imgui.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace ScriptProfiler {
+
+	using Clock = std::chrono::steady_clock;
+
+	constexpr size_t kHistory = 512;
+	constexpr const char* kDefaultCsv = "LuaEngineUI_profile.csv";
+
+	struct Sample {
+		float ms;
+		int32_t memory;
+		uint32_t cycles;
+	};
+
+	// Single-writer ring: the present thread pushes, readers take snapshots without locking.
+	// A reader racing the writer can at worst see the oldest sample being overwritten.
+	struct Series {
+		std::string name;
+		std::array<Sample, kHistory> samples{};
+		std::atomic<uint64_t> written{ 0 };
+	};
+
+	struct Summary {
+		size_t count = 0;
+		float p50 = 0, p95 = 0, p99 = 0, max = 0, mean = 0;
+		double memory = 0;
+		uint64_t cycles = 0;
+	};
+
+	static bool g_Enabled = false;
+	static bool g_ShowOverlay = false;
+	static std::vector<std::unique_ptr<Series>> g_Series;
+	static const char g_CyclesKey = 0;
+
+	static int64_t Now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+	}
+
+	static int64_t HeapBytes(lua_State* L) {
+		return static_cast<int64_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+	}
+
+	static lua_Integer Cycles(lua_State* L) {
+		lua_rawgetp(L, LUA_REGISTRYINDEX, &g_CyclesKey);
+		lua_Integer cycles = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+		return cycles;
+	}
+
+	static void Arm(lua_State* L);
+
+	// Finalizer of an unreachable sentinel: it runs once per completed GC cycle and re-arms itself
+	static int OnCollect(lua_State* L) {
+		lua_pushinteger(L, Cycles(L) + 1);
+		lua_rawsetp(L, LUA_REGISTRYINDEX, &g_CyclesKey);
+		Arm(L);
+		return 0;
+	}
+
+	static void Arm(lua_State* L) {
+		lua_newtable(L);
+		lua_createtable(L, 0, 1);
+		lua_pushcfunction(L, OnCollect);
+		lua_setfield(L, -2, "__gc");
+		lua_setmetatable(L, -2);
+		lua_pop(L, 1);
+	}
+
+	// Oldest first
+	static size_t Snapshot(const Series& series, std::vector<Sample>& out) {
+		const uint64_t written = series.written.load(std::memory_order_acquire);
+		const size_t count = static_cast<size_t>(std::min<uint64_t>(written, kHistory));
+		out.resize(count);
+		for (size_t i = 0; i < count; i++)
+			out[i] = series.samples[(written - count + i) % kHistory];
+		return count;
+	}
+
+	static Summary Summarize(const Series& series) {
+		static std::vector<Sample> samples;
+		static std::vector<float> times;
+		Summary summary;
+		summary.count = Snapshot(series, samples);
+		if (summary.count == 0)
+			return summary;
+
+		times.clear();
+		double total = 0;
+		for (const Sample& sample : samples) {
+			times.push_back(sample.ms);
+			total += sample.ms;
+			summary.memory += sample.memory;
+			summary.cycles += sample.cycles;
+		}
+		std::sort(times.begin(), times.end());
+		// Nearest rank
+		auto percentile = [&](double p) {
+			size_t rank = static_cast<size_t>(p * static_cast<double>(times.size()) + 0.999999);
+			return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+		};
+		summary.p50 = percentile(0.50);
+		summary.p95 = percentile(0.95);
+		summary.p99 = percentile(0.99);
+		summary.max = times.back();
+		summary.mean = static_cast<float>(total / static_cast<double>(summary.count));
+		summary.memory /= static_cast<double>(summary.count);
+		return summary;
+	}
+
+	static void Reset() {
+		for (auto& series : g_Series)
+			series->written.store(0, std::memory_order_release);
+	}
+
+	static void WriteCsvField(std::ofstream& out, const std::string& field) {
+		out << '"';
+		for (char c : field) {
+			if (c == '"')
+				out << '"';
+			out << c;
+		}
+		out << '"';
+	}
+
+	static bool Dump(const char* path) {
+		std::ofstream out(path, std::ios::trunc);
+		if (!out)
+			return false;
+		out << "script,sample,ms,heap_delta_bytes,gc_cycles\n";
+		std::vector<Sample> samples;
+		for (const auto& series : g_Series) {
+			Snapshot(*series, samples);
+			for (size_t i = 0; i < samples.size(); i++) {
+				WriteCsvField(out, series->name);
+				out << ',' << i << ',' << samples[i].ms << ',' << samples[i].memory << ',' << samples[i].cycles << '\n';
+			}
+		}
+		return static_cast<bool>(out);
+	}
+
+	static void SetEnabled(bool enabled) {
+		g_Enabled = enabled;
+	}
+
+	static void ShowOverlay(bool show) {
+		g_ShowOverlay = show;
+		if (show)
+			g_Enabled = true;
+	}
+
+	static sol::table GetScriptStats(sol::this_state s) {
+		sol::state_view lua(s);
+		sol::table result = lua.create_table(static_cast<int>(g_Series.size()), 0);
+		int index = 1;
+		for (const auto& series : g_Series) {
+			const Summary summary = Summarize(*series);
+			if (summary.count == 0)
+				continue;
+			result[index++] = lua.create_table_with(
+				"name", series->name,
+				"samples", summary.count,
+				"p50_ms", summary.p50,
+				"p95_ms", summary.p95,
+				"p99_ms", summary.p99,
+				"max_ms", summary.max,
+				"mean_ms", summary.mean,
+				"heap_delta_bytes", summary.memory,
+				"gc_cycles", summary.cycles
+			);
+		}
+		return result;
+	}
+
+	static bool DumpScriptStats(sol::optional<std::string> path) {
+		return Dump(path ? path->c_str() : kDefaultCsv);
+	}
+
+	void Init(sol::state_view& lua) {
+		lua_State* L = lua.lua_state();
+		lua_pushinteger(L, 0);
+		lua_rawsetp(L, LUA_REGISTRYINDEX, &g_CyclesKey);
+		Arm(L);
+
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("ProfileScripts"					, SetEnabled);
+		ImGui.set_function("ShowScriptProfiler"				, ShowOverlay);
+		ImGui.set_function("GetScriptStats"					, GetScriptStats);
+		ImGui.set_function("DumpScriptStats"				, DumpScriptStats);
+		ImGui.set_function("ResetScriptStats"				, Reset);
+	}
+
+	Series* Get(const std::string& name) {
+		for (auto& series : g_Series) {
+			if (series->name == name)
+				return series.get();
+		}
+		g_Series.push_back(std::make_unique<Series>());
+		g_Series.back()->name = name;
+		return g_Series.back().get();
+	}
+
+	bool Enabled() {
+		return g_Enabled;
+	}
+
+	Probe Begin(lua_State* L) {
+		return { L, Now(), HeapBytes(L), Cycles(L) };
+	}
+
+	void End(const Probe& probe, Series* series) {
+		const int64_t ns = Now() - probe.start;
+		const int64_t memory = HeapBytes(probe.L) - probe.memory;
+		Sample sample;
+		sample.ms = static_cast<float>(static_cast<double>(ns) / 1e6);
+		sample.memory = static_cast<int32_t>(std::clamp<int64_t>(memory, INT32_MIN, INT32_MAX));
+		sample.cycles = static_cast<uint32_t>(Cycles(probe.L) - probe.cycles);
+
+		const uint64_t written = series->written.load(std::memory_order_relaxed);
+		series->samples[written % kHistory] = sample;
+		series->written.store(written + 1, std::memory_order_release);
+	}
+
+	void DrawOverlay() {
+		if (!g_ShowOverlay)
+			return;
+		ImGui::SetNextWindowSize(ImVec2(560, 0), ImGuiCond_FirstUseEver);
+		if (ImGui::Begin("Script profiler", &g_ShowOverlay)) {
+			ImGui::Checkbox("Enabled", &g_Enabled);
+			ImGui::SameLine();
+			if (ImGui::Button("Reset"))
+				Reset();
+			ImGui::SameLine();
+			if (ImGui::Button("Dump CSV"))
+				Dump(kDefaultCsv);
+			ImGui::TextDisabled("last %zu calls per script", kHistory);
+
+			const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+			if (ImGui::BeginTable("scripts", 7, flags)) {
+				ImGui::TableSetupColumn("Script", ImGuiTableColumnFlags_WidthStretch);
+				ImGui::TableSetupColumn("p50 ms");
+				ImGui::TableSetupColumn("p95 ms");
+				ImGui::TableSetupColumn("p99 ms");
+				ImGui::TableSetupColumn("max ms");
+				ImGui::TableSetupColumn("heap B/call");
+				ImGui::TableSetupColumn("GC cycles");
+				ImGui::TableHeadersRow();
+				for (const auto& series : g_Series) {
+					const Summary summary = Summarize(*series);
+					if (summary.count == 0)
+						continue;
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(series->name.c_str());
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.p50);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.p95);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.p99);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", summary.max);
+					ImGui::TableNextColumn(); ImGui::Text("%.0f", summary.memory);
+					ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(summary.cycles));
+				}
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
+	}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <sol/sol.hpp>
+
+// Per-script cost of on_imgui. While enabled, each call records its wall time, the change in the
+// state's Lua heap and the GC cycles that completed during it into a fixed-size ring per script.
+// Scripts are keyed by name, so history survives reloads.
+//
+//	ImGui.ProfileScripts(true)
+//	ImGui.ShowScriptProfiler(true)		-- overlay with rolling p50/p95/p99
+//	for _, s in ipairs(ImGui.GetScriptStats()) do print(s.name, s.p50_ms, s.p95_ms, s.p99_ms) end
+//	ImGui.DumpScriptStats("profile.csv")
+namespace ScriptProfiler {
+
+	struct Series;
+
+	// Taken before a call; pass back to End.
+	struct Probe {
+		lua_State* L;
+		int64_t start;
+		int64_t memory;
+		lua_Integer cycles;
+	};
+
+	// Adds ImGui.ProfileScripts/ShowScriptProfiler/GetScriptStats/DumpScriptStats/ResetScriptStats
+	// and arms the GC cycle counter. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// History for a script name. The pointer stays valid for the lifetime of the DLL.
+	Series* Get(const std::string& name);
+
+	bool Enabled();
+
+	// Bracket one on_imgui call. Only valid while Enabled().
+	Probe Begin(lua_State* L);
+	void End(const Probe& probe, Series* series);
+
+	// Draws the overlay window if it is shown. Call between ImGui::NewFrame() and ImGui::Render().
+	void DrawOverlay();
+
+}
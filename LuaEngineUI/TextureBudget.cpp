@@ -0,0 +1,49 @@
+#include "TextureBudget.h"
+#include <iterator>
+
+namespace TextureBudget {
+
+	void Tracker::Add(uint64_t id, uint64_t bytes, uint64_t frame) {
+		Remove(id);
+		order.push_back({ id, bytes, frame });
+		items[id] = std::prev(order.end());
+		this->bytes += bytes;
+	}
+
+	void Tracker::Remove(uint64_t id) {
+		auto it = items.find(id);
+		if (it == items.end())
+			return;
+		bytes -= it->second->bytes;
+		order.erase(it->second);
+		items.erase(it);
+	}
+
+	void Tracker::Touch(uint64_t id, uint64_t frame) {
+		auto it = items.find(id);
+		if (it == items.end())
+			return;
+		it->second->frame = frame;
+		// Drawn many times a frame, so keep it to a relink
+		order.splice(order.end(), order, it->second);
+	}
+
+	void Tracker::Select(uint64_t budget, uint64_t frame, uint64_t minAge, std::vector<uint64_t>& out) const {
+		uint64_t remaining = bytes;
+		for (const Item& item : order) {
+			if (remaining <= budget || item.frame + minAge > frame)
+				break;
+			out.push_back(item.id);
+			remaining -= item.bytes;
+		}
+	}
+
+	uint64_t Tracker::Bytes() const {
+		return bytes;
+	}
+
+	size_t Tracker::Count() const {
+		return items.size();
+	}
+
+}
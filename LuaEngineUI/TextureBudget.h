@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Least-recently-drawn bookkeeping for the texture cache's VRAM budget. It deals in ids, sizes and
+// frame numbers only; the cache decides what an id is and does the freeing, so the policy runs the
+// same without a GPU.
+namespace TextureBudget {
+
+	struct Tracker {
+		// Starts tracking `bytes` of VRAM as used in `frame`; an id already tracked is replaced.
+		void Add(uint64_t id, uint64_t bytes, uint64_t frame);
+		void Remove(uint64_t id);
+		// Marks a draw. Unknown ids are ignored.
+		void Touch(uint64_t id, uint64_t frame);
+		// Ids to evict, least recently drawn first, until the rest fits in `budget`. Anything drawn
+		// within the last `minAge` frames stays, even if that leaves the total over budget.
+		void Select(uint64_t budget, uint64_t frame, uint64_t minAge, std::vector<uint64_t>& out) const;
+
+		uint64_t Bytes() const;
+		size_t Count() const;
+
+	private:
+		struct Item {
+			uint64_t id;
+			uint64_t bytes;
+			uint64_t frame;
+		};
+
+		// Least recently drawn at the front
+		std::list<Item> order;
+		std::unordered_map<uint64_t, std::list<Item>::iterator> items;
+		uint64_t bytes = 0;
+	};
+
+}
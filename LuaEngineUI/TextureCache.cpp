@@ -0,0 +1,355 @@
+#include "TextureCache.h"
+#include <algorithm>
+#include <cwctype>
+#include <filesystem>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#include "loader.h"
+#include "Archive.h"
+#include "IconAtlas.h"
+#include "DiskCache.h"
+
+namespace TextureCache {
+
+	namespace fs = std::filesystem;
+
+	using TextureEntries::Status;
+
+	// Frames a texture stays safe from eviction after it was drawn
+	constexpr uint64_t kDefaultIdleFrames = 120;
+	// Size cap of the disk cache's directory
+	constexpr double kDefaultDiskCacheMB = 1024.0;
+
+	struct Entry : TextureEntries::Slot {
+		std::wstring key;
+		uintmax_t size = 0;
+		int64_t mtime = 0;
+		// A newer version of the file replaced this one
+		bool stale = false;
+		IconAtlas::Placement placement;
+		std::vector<lua_State*> holders;
+	};
+
+	// Renderer, loader queue and VRAM budget behind every entry
+	static TextureEntries::Context g_Context{ .submit = TextureLoader::Submit };
+	static UpdateFn g_Update = nullptr;
+	// By handle. Handles are never reused, so an old one can't alias a new texture.
+	static std::unordered_map<uint64_t, Entry> g_Entries;
+	// Newest version of each file, by normalized path
+	static std::unordered_map<std::wstring, uint64_t> g_ByPath;
+	static uint64_t g_NextHandle = 1;
+	static std::vector<TextureLoader::Result> g_Results;
+
+	static uint64_t g_Hits = 0;
+	static uint64_t g_Misses = 0;
+
+	// 0 for no limit
+	static uint64_t g_BudgetBytes = 0;
+	static uint64_t g_IdleFrames = kDefaultIdleFrames;
+	static std::vector<uint64_t> g_Evict;
+
+	static const char* StatusName(Status status) {
+		switch (status) {
+		case Status::Ready:		return "ready";
+		case Status::Failed:	return "failed";
+		// Drawing it brings it back, so to scripts it's still there
+		case Status::Evicted:	return "ready";
+		default:				return "loading";
+		}
+	}
+
+	static std::wstring Normalize(const fs::path& file) {
+		std::error_code ec;
+		fs::path path = fs::absolute(file, ec);
+		if (ec)
+			path = file;
+		// Paths are case-insensitive on Windows
+		std::wstring key = path.lexically_normal().make_preferred().wstring();
+		std::transform(key.begin(), key.end(), key.begin(), [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
+		return key;
+	}
+
+	static void Hold(Entry& entry, lua_State* L) {
+		if (std::find(entry.holders.begin(), entry.holders.end(), L) == entry.holders.end())
+			entry.holders.push_back(L);
+	}
+
+	static bool Upload(uint64_t handle, Entry& entry, const TextureLoader::Image& image) {
+		if (TextureEntries::Upload(g_Context, handle, entry, image))
+			return true;
+		loader::LOG(loader::ERR) << "[LuaEngineUI] Texture upload failed: " << entry.path;
+		return false;
+	}
+
+	// The current entry for a file, or a new one when the file is new or changed on disk
+	static std::pair<uint64_t, Entry*> Lookup(const std::string& file, lua_State* L, const wchar_t* variant = L"") {
+		// A file loaded several ways (icon, with mips) gets an entry for each
+		const std::wstring key = Normalize(file) + variant;
+		// A member of an archive changes with the archive
+		std::string archive, member;
+		const std::string& source = Archive::Split(file, archive, member) ? archive : file;
+		std::error_code ec;
+		const uintmax_t size = fs::file_size(source, ec);
+		int64_t mtime = 0;
+		if (!ec)
+			mtime = fs::last_write_time(source, ec).time_since_epoch().count();
+		// Missing files get no entry, or a script retrying every frame would pile them up
+		if (ec)
+			return { 0, nullptr };
+
+		auto it = g_ByPath.find(key);
+		if (it != g_ByPath.end()) {
+			Entry& current = g_Entries[it->second];
+			if (current.size == size && current.mtime == mtime) {
+				g_Hits++;
+				Hold(current, L);
+				return { it->second, &current };
+			}
+			// The file changed: scripts still drawing the old version keep it until they go away
+			current.stale = true;
+			if (current.holders.empty()) {
+				TextureEntries::Free(g_Context, it->second, current);
+				g_Entries.erase(it->second);
+			}
+		}
+
+		g_Misses++;
+		const uint64_t handle = g_NextHandle++;
+		Entry& entry = g_Entries[handle];
+		entry.key = key;
+		entry.path = file;
+		entry.size = size;
+		entry.mtime = mtime;
+		entry.holders.push_back(L);
+		g_ByPath[key] = handle;
+		return { handle, &entry };
+	}
+
+	static std::tuple<uint64_t, int, int> LoadTexture(sol::this_state s, const std::string& file, sol::optional<bool> mips) {
+		auto [handle, entry] = Lookup(file, sol::main_thread(s, s), mips.value_or(false) ? L"|mips" : L"");
+		if (!entry) {
+			loader::LOG(loader::ERR) << "[LuaEngineUI] LoadTexture failed: " << file;
+			return std::make_tuple(uint64_t(0), 0, 0);
+		}
+		// A pending async load of the same file is finished here; its worker result is dropped later
+		if (TextureEntries::NeedsLoad(*entry)) {
+			entry->mips = mips.value_or(false);
+			TextureLoader::Image image;
+			if (!TextureLoader::Load(file, entry->mips, image)) {
+				entry->status = Status::Failed;
+				loader::LOG(loader::ERR) << "[LuaEngineUI] LoadTexture failed: " << file;
+			}
+			else {
+				Upload(handle, *entry, image);
+			}
+		}
+		if (entry->status != Status::Ready)
+			return std::make_tuple(uint64_t(0), 0, 0);
+		return std::make_tuple(handle, entry->texture.width, entry->texture.height);
+	}
+
+	static uint64_t LoadTextureAsync(sol::this_state s, const std::string& file, sol::optional<bool> mips) {
+		auto [handle, entry] = Lookup(file, sol::main_thread(s, s), mips.value_or(false) ? L"|mips" : L"");
+		if (!entry) {
+			loader::LOG(loader::ERR) << "[LuaEngineUI] LoadTextureAsync failed: " << file;
+			return 0;
+		}
+		if (TextureEntries::NeedsLoad(*entry) && !entry->queued) {
+			entry->mips = mips.value_or(false);
+			TextureEntries::Queue(g_Context, handle, *entry);
+		}
+		return handle;
+	}
+
+	static std::tuple<uint64_t, int, int> LoadIcon(sol::this_state s, const std::string& file) {
+		auto [handle, entry] = Lookup(file, sol::main_thread(s, s), L"|icon");
+		if (!entry) {
+			loader::LOG(loader::ERR) << "[LuaEngineUI] LoadIcon failed: " << file;
+			return std::make_tuple(uint64_t(0), 0, 0);
+		}
+		if (TextureEntries::NeedsLoad(*entry)) {
+			TextureLoader::Image image;
+			if (!TextureLoader::Load(file, false, image)) {
+				entry->status = Status::Failed;
+				loader::LOG(loader::ERR) << "[LuaEngineUI] LoadIcon failed: " << file;
+			}
+			else if (IconAtlas::Add(image, entry->placement)) {
+				entry->icon = true;
+				entry->status = Status::Ready;
+				entry->texture.width = image.width;
+				entry->texture.height = image.height;
+			}
+			else {
+				// Too big for the atlas
+				Upload(handle, *entry, image);
+			}
+		}
+		if (entry->status != Status::Ready)
+			return std::make_tuple(uint64_t(0), 0, 0);
+		return std::make_tuple(handle, entry->texture.width, entry->texture.height);
+	}
+
+	static std::tuple<const char*, int, int> TextureStatus(long long handle) {
+		auto it = g_Entries.find(static_cast<uint64_t>(handle));
+		if (it == g_Entries.end())
+			return std::make_tuple("failed", 0, 0);
+		const Entry& entry = it->second;
+		return std::make_tuple(StatusName(entry.status), entry.texture.width, entry.texture.height);
+	}
+
+	// Drops the calling script's reference; the texture is freed once no script holds it. Returns
+	// false for an unknown handle.
+	static bool UnloadTexture(sol::this_state s, long long handle) {
+		auto it = g_Entries.find(static_cast<uint64_t>(handle));
+		if (it == g_Entries.end())
+			return false;
+		Entry& entry = it->second;
+		std::erase(entry.holders, sol::main_thread(s, s));
+		if (!entry.holders.empty())
+			return true;
+		// An icon's space in its page is not given back
+		TextureEntries::Free(g_Context, it->first, entry);
+		auto path = g_ByPath.find(entry.key);
+		if (path != g_ByPath.end() && path->second == it->first)
+			g_ByPath.erase(path);
+		g_Entries.erase(it);
+		return true;
+	}
+
+	static void SetTextureBudget(double megabytes, sol::optional<int> frames) {
+		g_BudgetBytes = megabytes > 0.0 ? static_cast<uint64_t>(megabytes * 1024.0 * 1024.0) : 0;
+		g_IdleFrames = static_cast<uint64_t>(std::max(frames.value_or(static_cast<int>(kDefaultIdleFrames)), 1));
+	}
+
+	static sol::table GetTextureCacheStats(sol::this_state s) {
+		sol::state_view lua(s);
+		size_t icons = 0, loading = 0, failed = 0, evicted = 0, stale = 0, unreferenced = 0;
+		for (const auto& [handle, entry] : g_Entries) {
+			icons += entry.icon;
+			loading += entry.status == Status::Loading;
+			failed += entry.status == Status::Failed;
+			evicted += entry.status == Status::Evicted;
+			stale += entry.stale;
+			unreferenced += entry.holders.empty();
+		}
+		const DiskCache::Stats disk = DiskCache::GetStats();
+		return lua.create_table_with(
+			"textures", g_Entries.size(),
+			"icons", icons,
+			"loading", loading,
+			"failed", failed,
+			"stale", stale,
+			"unreferenced", unreferenced,
+			"hits", g_Hits,
+			"misses", g_Misses,
+			"atlas_pages", IconAtlas::Pages(),
+			"atlas_occupancy", IconAtlas::Occupancy(),
+			"disk_hits", disk.hits,
+			"disk_misses", disk.misses,
+			"disk_writes", disk.writes,
+			"disk_removed", disk.removed,
+			"vram_bytes", g_Context.budget.Bytes(),
+			"budget_bytes", g_BudgetBytes,
+			"evicted", evicted,
+			"evictions", g_Context.evictions
+		);
+	}
+
+	static void SetTextureDiskCache(sol::optional<std::string> directory, sol::optional<double> megabytes) {
+		const double cap = megabytes.value_or(kDefaultDiskCacheMB);
+		DiskCache::SetDirectory(directory.value_or(""), cap > 0.0 ? static_cast<uint64_t>(cap * 1024.0 * 1024.0) : 0);
+	}
+
+	void SetBackend(UploadFn upload, UpdateFn update, ReleaseFn release) {
+		g_Context.upload = upload;
+		g_Context.release = release;
+		g_Update = update;
+	}
+
+	void Init(sol::state_view& lua) {
+		lua.set_function("LoadTexture", LoadTexture);
+		lua.set_function("LoadTextureAsync", LoadTextureAsync);
+		lua.set_function("LoadIcon", LoadIcon);
+		lua.set_function("TextureStatus", TextureStatus);
+		lua.set_function("UnloadTexture", UnloadTexture);
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("GetTextureCacheStats"			, GetTextureCacheStats);
+		ImGui.set_function("SetTextureDiskCache"			, SetTextureDiskCache);
+		ImGui.set_function("SetTextureBudget"				, SetTextureBudget);
+	}
+
+	void Forget(const std::vector<lua_State*>& removed) {
+		std::erase_if(g_Entries, [&](auto& item) {
+			Entry& entry = item.second;
+			std::erase_if(entry.holders, [&](lua_State* L) {
+				return std::find(removed.begin(), removed.end(), L) != removed.end();
+			});
+			if (!entry.stale || !entry.holders.empty())
+				return false;
+			TextureEntries::Free(g_Context, item.first, entry);
+			return true;
+		});
+	}
+
+	void Update(uint64_t replayAge) {
+		g_Context.frame++;
+		IconAtlas::Update(g_Context.upload, g_Update);
+		TextureLoader::Collect(g_Results);
+		for (TextureLoader::Result& result : g_Results) {
+			auto it = g_Entries.find(result.job);
+			if (it == g_Entries.end())
+				continue;
+			Entry& entry = it->second;
+			// LoadTexture got there first
+			if (!TextureEntries::Accept(entry))
+				continue;
+			if (!result.ok) {
+				entry.status = Status::Failed;
+				loader::LOG(loader::ERR) << "[LuaEngineUI] LoadTextureAsync failed: " << entry.path;
+				continue;
+			}
+			Upload(it->first, entry, result.image);
+		}
+		g_Results.clear();
+
+		if (g_BudgetBytes == 0 || g_Context.budget.Bytes() <= g_BudgetBytes)
+			return;
+		g_Context.budget.Select(g_BudgetBytes, g_Context.frame, std::max(g_IdleFrames, replayAge + 1), g_Evict);
+		for (uint64_t handle : g_Evict)
+			TextureEntries::Evict(g_Context, handle, g_Entries[handle]);
+		g_Evict.clear();
+	}
+
+	bool Loading() {
+		return TextureLoader::Pending() > 0 || TextureLoader::Done() > 0;
+	}
+
+	bool Resolve(long long handle, const ImVec2& size, ImTextureID& id, ImVec4& uv) {
+		auto it = g_Entries.find(static_cast<uint64_t>(handle));
+		if (it == g_Entries.end())
+			return false;
+		Entry& entry = it->second;
+		if (!TextureEntries::Draw(g_Context, it->first, entry))
+			return false;
+		if (entry.icon)
+			return IconAtlas::Resolve(entry.placement, id, uv);
+		// The smallest level that is still at least as big as what gets drawn
+		const Texture& texture = entry.texture;
+		size_t level = 0;
+		while (level < texture.levels.size()
+			&& (texture.width >> (level + 1)) >= size.x && (texture.height >> (level + 1)) >= size.y)
+			level++;
+		id = (ImTextureID)(level == 0 ? texture.id : texture.levels[level - 1].id);
+		uv = ImVec4(0.0f, 0.0f, 1.0f, 1.0f);
+		return true;
+	}
+
+	void Reset() {
+		IconAtlas::Reset(g_Context.release);
+		for (auto& [handle, entry] : g_Entries)
+			TextureEntries::Reset(g_Context, handle, entry);
+	}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <imgui.h>
+#include <sol/sol.hpp>
+
+#include "TextureEntries.h"
+
+// Content-addressed cache behind LoadTexture. A file is keyed by its normalized path plus size and
+// modification time, so every script (and every reload of it) that loads the same unchanged file
+// gets the same texture. Each state holding a texture counts as one reference; a texture nobody
+// holds stays cached for the next load, and an outdated version is freed once nobody holds it.
+//
+// Scripts get stable handles that ImGui.Image resolves on each call. LoadTextureAsync returns one
+// right away and decodes on worker threads; until the upload, Image keeps the space empty.
+// LoadIcon packs small images into shared atlas pages; its handles cover their part of the page,
+// and Image's uv arguments stay relative to the icon.
+//
+// UnloadTexture frees a texture once no script holds it. Under a VRAM budget, textures not drawn
+// for a while are evicted least recently drawn first; their handles stay valid, and the next Image
+// call loads them again in the background. Atlas icons are never evicted.
+//
+//	local tex, w, h = LoadTexture("icons/sword.png")	-- decoded once, shared by all scripts
+//	local map = LoadTextureAsync("maps/forest.png", true)	-- with a mip chain, for drawing it scaled down
+//	local status, mw, mh = TextureStatus(map)		-- "loading", "ready" or "failed"
+//	if status == "ready" then ImGui.Image(map, mw, mh) end
+//	local sword, sw, sh = LoadIcon("icons/sword.png")	-- drawn from the next frame on
+//	local shield = LoadIcon("icons.zip/shield.png")		-- a member of a zip stored without compression
+//	ImGui.SetTextureDiskCache("cache/textures", 512)	-- keep decoded pixels on disk for the next run, up to MB (default 1024, 0 for no cap); nil turns it off
+//	ImGui.SetTextureBudget(256, 120)			-- MB of textures (0 for no limit), frames a drawn texture is kept
+//	UnloadTexture(tex)					-- the handle is invalid afterwards
+//	local s = ImGui.GetTextureCacheStats()			-- textures, icons, loading, failed, stale, unreferenced, hits, misses, atlas_pages, atlas_occupancy, disk_hits, disk_misses, disk_writes, disk_removed, vram_bytes, budget_bytes, evicted, evictions
+namespace TextureCache {
+
+	// Renderer side, see TextureEntries
+	using Texture = TextureEntries::Texture;
+	using UploadFn = TextureEntries::UploadFn;
+	using UpdateFn = TextureEntries::UpdateFn;
+	using ReleaseFn = TextureEntries::ReleaseFn;
+	void SetBackend(UploadFn upload, UpdateFn update, ReleaseFn release);
+
+	// Adds LoadTexture/LoadTextureAsync/LoadIcon/TextureStatus/UnloadTexture and
+	// ImGui.GetTextureCacheStats/SetTextureDiskCache/SetTextureBudget.
+	// Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Drops the references of states that went away. Those states are never touched.
+	void Forget(const std::vector<lua_State*>& removed);
+
+	// Uploads what the workers decoded since the last call and evicts what is over budget. Call
+	// once per frame on the thread that runs the scripts, before they run. Nothing drawn within
+	// the last `replayAge` frames is evicted, since lists that old may still be drawn again.
+	void Update(uint64_t replayAge);
+
+	// Whether async loads are still decoding or waiting for Update to upload them.
+	bool Loading();
+
+	// The ImTextureID behind a handle and the uv rect (x0, y0, x1, y1) it covers; false while it
+	// is loading or unknown. `size` is how big the whole texture would be drawn, in pixels, and
+	// picks the mip level. Each call counts as a draw for the budget, and an evicted texture is
+	// queued to load again.
+	bool Resolve(long long handle, const ImVec2& size, ImTextureID& id, ImVec4& uv);
+
+	// Releases every texture, for when the renderer goes away. Handles stay valid: their files
+	// are decoded again and uploaded by the first Update after the backend is back.
+	void Reset();
+
+}
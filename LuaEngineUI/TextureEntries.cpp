@@ -0,0 +1,80 @@
+#include "TextureEntries.h"
+
+namespace TextureEntries {
+
+	// Frees the texture but keeps the size scripts were given, for one that comes back
+	static void Unload(Context& ctx, uint64_t handle, Slot& slot) {
+		const int width = slot.texture.width;
+		const int height = slot.texture.height;
+		Free(ctx, handle, slot);
+		slot.texture.width = width;
+		slot.texture.height = height;
+	}
+
+	bool NeedsLoad(const Slot& slot) {
+		return slot.status == Status::Loading || slot.status == Status::Evicted;
+	}
+
+	bool Upload(Context& ctx, uint64_t handle, Slot& slot, const TextureLoader::Image& image) {
+		if (!ctx.upload || !ctx.upload(image, slot.texture)) {
+			slot.status = Status::Failed;
+			return false;
+		}
+		slot.status = Status::Ready;
+		size_t bytes = 0;
+		for (int level = 0; level < image.mips; level++)
+			bytes += TextureLoader::LevelSize(image.format, TextureLoader::MipExtent(image.width, level), TextureLoader::MipExtent(image.height, level));
+		ctx.budget.Add(handle, bytes, ctx.frame);
+		return true;
+	}
+
+	void Free(Context& ctx, uint64_t handle, Slot& slot) {
+		if (slot.status == Status::Ready && !slot.icon && ctx.release)
+			ctx.release(slot.texture);
+		slot.texture = Texture();
+		ctx.budget.Remove(handle);
+	}
+
+	void Evict(Context& ctx, uint64_t handle, Slot& slot) {
+		Unload(ctx, handle, slot);
+		slot.status = Status::Evicted;
+		ctx.evictions++;
+	}
+
+	void Queue(Context& ctx, uint64_t handle, Slot& slot) {
+		slot.status = Status::Loading;
+		slot.queued = true;
+		if (ctx.submit)
+			ctx.submit(handle, slot.path, slot.mips);
+	}
+
+	bool Accept(Slot& slot) {
+		slot.queued = false;
+		return slot.status == Status::Loading;
+	}
+
+	bool Draw(Context& ctx, uint64_t handle, Slot& slot) {
+		if (slot.status == Status::Evicted) {
+			if (slot.queued)
+				slot.status = Status::Loading;
+			else
+				Queue(ctx, handle, slot);
+		}
+		if (slot.status != Status::Ready)
+			return false;
+		// Icons are not in the budget; unknown ids are ignored
+		ctx.budget.Touch(handle, ctx.frame);
+		return true;
+	}
+
+	void Reset(Context& ctx, uint64_t handle, Slot& slot) {
+		if (slot.icon || slot.status == Status::Evicted)
+			return;
+		Unload(ctx, handle, slot);
+		if (slot.queued)
+			slot.status = Status::Loading;
+		else
+			Queue(ctx, handle, slot);
+	}
+
+}
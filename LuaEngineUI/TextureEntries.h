@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TextureBudget.h"
+#include "TextureLoader.h"
+
+// The life of one texture cache entry, apart from the Lua bindings and file lookups around it. An
+// entry is Loading until its pixels are uploaded (Ready) or can't be (Failed). The VRAM budget may
+// free a Ready one (Evicted); its next draw queues it again. The renderer and the loader's job
+// queue are reached through function pointers, so every transition runs without a GPU or workers.
+namespace TextureEntries {
+
+	struct Texture {
+		// What the renderer takes as ImTextureID
+		uint64_t id = 0;
+		int width = 0;
+		int height = 0;
+		// Owned by the backend
+		void* resource = nullptr;
+		uint32_t descriptor = 0;
+
+		// A view starting at a lower mip level. ImGui's sampler never leaves the top level of the
+		// view it is given, so Resolve picks the one that matches the drawn size.
+		struct Level {
+			uint64_t id = 0;
+			uint32_t descriptor = 0;
+		};
+		// levels[i] starts at mip level i + 1; empty without mips
+		std::vector<Level> levels;
+	};
+
+	// Renderer side. `upload` creates a texture from decoded pixels; `update` writes pixels into a
+	// region of one that frames may be drawing other regions of; `release` frees one and must wait
+	// on its own until nothing can sample it: frames in flight, and draw data built before the call
+	// that may still be presented.
+	using UploadFn = bool(*)(const TextureLoader::Image& image, Texture& out);
+	using UpdateFn = bool(*)(const Texture& texture, int x, int y, const TextureLoader::Image& region);
+	using ReleaseFn = void(*)(const Texture& texture);
+	// Starts decoding on a worker; TextureLoader::Submit outside of tests
+	using SubmitFn = void(*)(uint64_t job, std::string path, bool mips);
+
+	enum class Status : uint8_t {
+		Loading,
+		Ready,
+		Failed,
+		// Freed to stay under the VRAM budget; the next draw loads it again
+		Evicted,
+	};
+
+	struct Slot {
+		std::string path;
+		Status status = Status::Loading;
+		// A worker is decoding it
+		bool queued = false;
+		// Packed into the atlas instead of a texture of its own
+		bool icon = false;
+		// Loaded with a mip chain
+		bool mips = false;
+		Texture texture;
+	};
+
+	// What all slots are uploaded, released and budgeted through
+	struct Context {
+		UploadFn upload = nullptr;
+		ReleaseFn release = nullptr;
+		SubmitFn submit = nullptr;
+		TextureBudget::Tracker budget;
+		uint64_t frame = 0;
+		uint64_t evictions = 0;
+	};
+
+	// Whether a load has to read the file: it was never uploaded, or the budget freed it.
+	bool NeedsLoad(const Slot& slot);
+
+	// Uploads decoded pixels and counts them against the budget. False, with the slot Failed, when
+	// there is no renderer or it refuses them.
+	bool Upload(Context& ctx, uint64_t handle, Slot& slot, const TextureLoader::Image& image);
+
+	// Releases the texture and forgets its size.
+	void Free(Context& ctx, uint64_t handle, Slot& slot);
+
+	// Releases the texture to stay under the budget. Scripts keep the size they were given.
+	void Evict(Context& ctx, uint64_t handle, Slot& slot);
+
+	// Hands the file to a worker, under the slot's handle as the job.
+	void Queue(Context& ctx, uint64_t handle, Slot& slot);
+
+	// A worker finished the slot's job. False when the result is to be dropped because a
+	// synchronous load got there first; otherwise the caller uploads it or marks the slot Failed.
+	bool Accept(Slot& slot);
+
+	// Counts a draw. An evicted slot is queued to load again, or waits for the job still in flight.
+	// True when the slot can be drawn.
+	bool Draw(Context& ctx, uint64_t handle, Slot& slot);
+
+	// Releases the texture for a renderer that goes away and queues the file again, keeping its
+	// size. Icons come back with their atlas pages and evicted slots when drawn, so both are left
+	// as they are.
+	void Reset(Context& ctx, uint64_t handle, Slot& slot);
+
+}
@@ -0,0 +1,222 @@
+#include "TextureLoader.h"
+#include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// stb_image is vendored as is; its warnings are not ours to fix
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include "Archive.h"
+#include "Dds.h"
+#include "DiskCache.h"
+#include "Hash.h"
+#include "Mipmaps.h"
+
+namespace TextureLoader {
+
+	constexpr unsigned kMaxWorkers = 4;
+
+	struct Job {
+		uint64_t job;
+		std::string path;
+		bool mips;
+	};
+
+	static std::mutex g_Mutex;
+	static std::condition_variable g_Wake;
+	static std::deque<Job> g_Jobs;
+	static std::vector<Result> g_Done;
+	static size_t g_Pending = 0;
+	static std::vector<std::thread> g_Workers;
+	static bool g_Stop = false;
+
+	static void Worker() {
+		for (;;) {
+			Job job;
+			{
+				std::unique_lock lock(g_Mutex);
+				g_Wake.wait(lock, [] { return g_Stop || !g_Jobs.empty(); });
+				if (g_Stop)
+					return;
+				job = std::move(g_Jobs.front());
+				g_Jobs.pop_front();
+			}
+
+			Result result{ job.job, false, {} };
+			result.ok = Load(job.path, job.mips, result.image);
+
+			std::lock_guard lock(g_Mutex);
+			g_Done.push_back(std::move(result));
+			g_Pending--;
+		}
+	}
+
+
+	size_t RowPitch(Format format, int width) {
+		switch (format) {
+		case Format::BC1:	return static_cast<size_t>(std::max(1, (width + 3) / 4)) * 8;
+		case Format::BC3:
+		case Format::BC7:	return static_cast<size_t>(std::max(1, (width + 3) / 4)) * 16;
+		default:			return static_cast<size_t>(width) * 4;
+		}
+	}
+
+	int Rows(Format format, int height) {
+		return format == Format::RGBA8 ? height : std::max(1, (height + 3) / 4);
+	}
+
+	size_t LevelSize(Format format, int width, int height) {
+		return RowPitch(format, width) * Rows(format, height);
+	}
+
+	int MipExtent(int extent, int level) {
+		return std::max(1, extent >> level);
+	}
+
+	// The bytes of a file, or of a member of an archive, kept alive by `file` or `zip`
+	struct Source {
+		FileMap::Mapping file;
+		std::shared_ptr<const Archive::Zip> zip;
+		const unsigned char* data = nullptr;
+		size_t size = 0;
+
+		bool Open(const std::string& path) {
+			std::string archive, member;
+			if (Archive::Split(path, archive, member)) {
+				zip = Archive::Acquire(archive);
+				return zip && zip->Find(member, data, size);
+			}
+			if (!file.Open(path))
+				return false;
+			data = file.Data();
+			size = file.Size();
+			return true;
+		}
+	};
+
+	static bool IsDds(const unsigned char* data, size_t size) {
+		return size >= 4 && memcmp(data, "DDS ", 4) == 0;
+	}
+
+	bool Decode(const std::string& path, Image& out) {
+		Source source;
+		return source.Open(path) && Decode(source.data, source.size, out);
+	}
+
+	bool Decode(const unsigned char* data, size_t size, Image& out) {
+		out.mapping.reset();
+		out.mapped = nullptr;
+		if (IsDds(data, size))
+			return Dds::Parse(data, size, out);
+		if (size > INT_MAX)
+			return false;
+
+		int width = 0;
+		int height = 0;
+		unsigned char* pixels = stbi_load_from_memory(data, static_cast<int>(size), &width, &height, NULL, 4);
+		if (pixels == NULL)
+			return false;
+		out.format = Format::RGBA8;
+		out.width = width;
+		out.height = height;
+		out.mips = 1;
+		out.pixels.resize(static_cast<size_t>(width) * height * 4);
+		memcpy(out.pixels.data(), pixels, out.pixels.size());
+		stbi_image_free(pixels);
+		return true;
+	}
+
+	bool Load(const std::string& path, bool mips, Image& out) {
+		Source source;
+		if (!source.Open(path))
+			return false;
+
+		// DDS files are already laid out for upload
+		const std::string directory = DiskCache::Directory();
+		const bool cached = !directory.empty() && !IsDds(source.data, source.size);
+		uint64_t key = 0;
+		std::string entry;
+		if (cached) {
+			key = Hash::Bytes(source.data, source.size, uint64_t(DiskCache::kVersion) << 1 | uint64_t(mips));
+			entry = DiskCache::Path(directory, key);
+			if (DiskCache::Read(entry, key, out))
+				return true;
+		}
+
+		if (!Decode(source.data, source.size, out))
+			return false;
+		if (mips)
+			Mipmaps::Generate(out);
+		if (cached)
+			DiskCache::Write(entry, key, out);
+		return true;
+	}
+
+	// Call with g_Mutex held. Not while a Stop is joining the previous workers.
+	static void StartWorkers() {
+		if (!g_Workers.empty() || g_Stop)
+			return;
+		const unsigned workers = std::clamp(std::thread::hardware_concurrency() / 2, 1u, kMaxWorkers);
+		for (unsigned i = 0; i < workers; i++)
+			g_Workers.emplace_back(Worker);
+	}
+
+	void Submit(uint64_t job, std::string path, bool mips) {
+		{
+			std::lock_guard lock(g_Mutex);
+			StartWorkers();
+			g_Jobs.push_back({ job, std::move(path), mips });
+			g_Pending++;
+		}
+		g_Wake.notify_one();
+	}
+
+	void Collect(std::vector<Result>& out) {
+		Archive::Trim();
+		std::lock_guard lock(g_Mutex);
+		// Jobs a Stop left in the queue
+		if (!g_Jobs.empty())
+			StartWorkers();
+		for (Result& result : g_Done)
+			out.push_back(std::move(result));
+		g_Done.clear();
+	}
+
+	size_t Pending() {
+		std::lock_guard lock(g_Mutex);
+		return g_Pending;
+	}
+
+	size_t Done() {
+		std::lock_guard lock(g_Mutex);
+		return g_Done.size();
+	}
+
+	void Stop() {
+		std::vector<std::thread> workers;
+		{
+			std::lock_guard lock(g_Mutex);
+			g_Stop = true;
+			workers.swap(g_Workers);
+		}
+		g_Wake.notify_all();
+		for (std::thread& worker : workers)
+			worker.join();
+		std::lock_guard lock(g_Mutex);
+		g_Stop = false;
+	}
+
+}
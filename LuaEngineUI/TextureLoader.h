@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FileMap.h"
+
+// Image decoding for the texture cache, on a small worker pool. Nothing here touches the renderer
+// or the Lua states: jobs go in with Submit, decoded images come back through Collect on whichever
+// thread owns the cache, and the upload is left to the renderer backend.
+namespace TextureLoader {
+
+	enum class Format : uint8_t {
+		RGBA8,
+		// Block-compressed, 4x4 texels per block
+		BC1,
+		BC3,
+		BC7,
+	};
+
+	// Mip levels are stored back to back from the largest, each with tightly packed rows. For
+	// block-compressed formats a row is a row of blocks.
+	struct Image {
+		Format format = Format::RGBA8;
+		int width = 0;
+		int height = 0;
+		int mips = 1;
+		std::vector<unsigned char> pixels;
+		// Set instead of `pixels` when the levels are read in place from a mapped file
+		std::shared_ptr<const FileMap::Mapping> mapping;
+		const unsigned char* mapped = nullptr;
+
+		const unsigned char* Data() const { return mapped ? mapped : pixels.data(); }
+	};
+
+	// Layout of one level of a `width` x `height` image
+	size_t RowPitch(Format format, int width);
+	int Rows(Format format, int height);
+	size_t LevelSize(Format format, int width, int height);
+	// Size of a level below the top one
+	int MipExtent(int extent, int level);
+
+	// Decodes on the calling thread. DDS files keep their compressed format and mips; everything
+	// else goes through stb_image to RGBA8. Files are mapped rather than read; a path through a
+	// zip archive ("icons.zip/sword.png") decodes the member straight from the archive's mapping.
+	bool Decode(const std::string& path, Image& out);
+	// The same for a file already in memory
+	bool Decode(const unsigned char* data, size_t size, Image& out);
+
+	// Decode plus a mip chain when `mips` is set, going through the disk cache when one is set up:
+	// a hit skips the decode and reads the levels straight from the cache file's mapping.
+	bool Load(const std::string& path, bool mips, Image& out);
+
+	struct Result {
+		uint64_t job;
+		bool ok;
+		Image image;
+	};
+
+	// Queues a Load. Workers start on first use.
+	void Submit(uint64_t job, std::string path, bool mips = false);
+	// Appends the finished jobs, in completion order.
+	void Collect(std::vector<Result>& out);
+	// Jobs queued or being decoded.
+	size_t Pending();
+	// Finished jobs Collect has not picked up yet.
+	size_t Done();
+
+	// Lets the workers finish the file they are on and joins them. Queued jobs stay queued; the
+	// next Submit or Collect starts workers again.
+	void Stop();
+
+}
@@ -0,0 +1,44 @@
+#include "UIRate.h"
+#include <algorithm>
+#include <chrono>
+
+namespace UIRate {
+
+	using Clock = std::chrono::steady_clock;
+
+	static double g_Rate = 0;
+	static Clock::time_point g_LastUpdate;
+	static uint64_t g_Updates = 0;
+	static uint64_t g_Repeats = 0;
+
+	static void SetUIRate(double hz) {
+		g_Rate = std::max(hz, 0.0);
+	}
+
+	static sol::table GetUIRate(sol::this_state s) {
+		sol::state_view lua(s);
+		return lua.create_table_with(
+			"rate", g_Rate,
+			"updates", g_Updates,
+			"repeats", g_Repeats
+		);
+	}
+
+	void Init(sol::state_view& lua) {
+		sol::table ImGui = lua["ImGui"];
+		ImGui.set_function("SetUIRate"						, SetUIRate);
+		ImGui.set_function("GetUIRate"						, GetUIRate);
+	}
+
+	bool Due() {
+		const auto now = Clock::now();
+		if (g_Rate > 0 && std::chrono::duration<double>(now - g_LastUpdate).count() < 1.0 / g_Rate) {
+			g_Repeats++;
+			return false;
+		}
+		g_LastUpdate = now;
+		g_Updates++;
+		return true;
+	}
+
+}
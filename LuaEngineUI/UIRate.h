@@ -0,0 +1,21 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+// Reduced-rate UI updates. With a rate set, the UI frame (NewFrame, the scripts, Render) is only
+// rebuilt that many times per second; on the presents in between the last draw data is rendered
+// again, which FrameReuse usually turns into re-executing the recorded command list. Input that
+// arrives meanwhile waits in InputQueue for the next update. Individual scripts, and so their
+// windows, can run slower still through ImGui.SetSchedule({ rate = ... }).
+//
+//	ImGui.SetUIRate(30)				-- 0 rebuilds on every present
+//	local r = ImGui.GetUIRate()		-- rate, updates, repeats
+namespace UIRate {
+
+	// Adds ImGui.SetUIRate/GetUIRate. Must run after sol_ImGui::Init.
+	void Init(sol::state_view& lua);
+
+	// Whether the UI should be rebuilt on this present. Counts the decision.
+	bool Due();
+
+}
@@ -0,0 +1,69 @@
+#include "UploadRing.h"
+
+namespace UploadRing {
+
+	static uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	void Ring::Reset(uint64_t size) {
+		blocks.clear();
+		this->size = size;
+		head = tail = used = 0;
+	}
+
+	uint64_t Ring::Allocate(uint64_t bytes, uint64_t alignment, uint64_t fence) {
+		if (bytes == 0 || bytes > size)
+			return kFull;
+		if (used == 0)
+			head = tail = 0;
+		else if (head == tail)
+			return kFull;
+
+		uint64_t offset = AlignUp(head, alignment);
+		if (used == 0 || head > tail) {
+			// Free space runs to the end, then again from the start up to the tail
+			if (offset + bytes > size) {
+				if (bytes > tail && used != 0)
+					return kFull;
+				offset = 0;
+			}
+		}
+		else if (offset + bytes > tail) {
+			return kFull;
+		}
+
+		const uint64_t end = offset + bytes;
+		// Padding, or everything up to the end of the buffer on a wrap
+		const uint64_t consumed = offset >= head ? end - head : size - head + end;
+		used += consumed;
+		head = end == size ? 0 : end;
+		if (!blocks.empty() && blocks.back().fence == fence) {
+			blocks.back().end = head;
+			blocks.back().bytes += consumed;
+		}
+		else {
+			blocks.push_back({ fence, head, consumed });
+		}
+		return offset;
+	}
+
+	void Ring::Retire(uint64_t completed) {
+		while (!blocks.empty() && blocks.front().fence <= completed) {
+			tail = blocks.front().end;
+			used -= blocks.front().bytes;
+			blocks.pop_front();
+		}
+		if (used == 0)
+			head = tail = 0;
+	}
+
+	uint64_t Ring::Size() const {
+		return size;
+	}
+
+	uint64_t Ring::Used() const {
+		return used;
+	}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+// Suballocation of a persistent upload buffer. Allocations are tagged with the fence value of the
+// batch that reads them and come back once that value completed; the ring wraps to the start when
+// the end has no room. Offsets only, so any backend can put its own buffer behind it.
+namespace UploadRing {
+
+	constexpr uint64_t kFull = UINT64_MAX;
+
+	struct Ring {
+		void Reset(uint64_t size);
+		// Offset of `size` bytes aligned to `alignment` (a power of two), or kFull when it doesn't
+		// fit before older batches retire. Fences must not decrease between calls.
+		uint64_t Allocate(uint64_t size, uint64_t alignment, uint64_t fence);
+		// Frees everything tagged with a fence up to `completed`.
+		void Retire(uint64_t completed);
+
+		uint64_t Size() const;
+		// Including padding and space skipped at a wrap
+		uint64_t Used() const;
+
+	private:
+		struct Block {
+			uint64_t fence;
+			// Tail once this block is freed
+			uint64_t end;
+			uint64_t bytes;
+		};
+
+		std::deque<Block> blocks;
+		uint64_t size = 0;
+		uint64_t head = 0;
+		uint64_t tail = 0;
+		uint64_t used = 0;
+	};
+
+}
@@ -25,20 +25,17 @@ namespace LuaCore {
             bool start = true
         ) :L(L), name(name), file(file), start(start) { };
     };
-    bool initUI = false;
+    inline bool initUI = false;
     DllExport extern time_t reloadTime;
-    time_t reload;
+    inline time_t reload;
     DllExport extern void run(std::string func, lua_State* runL = nullptr);
     DllExport extern std::vector<std::string> getLuaFils();
     DllExport extern std::map<std::string, LuaScriptData> getLuas();
     DllExport extern void Lua_register(std::string, int(*func)(lua_State* pL));
-    void Imgui_Bindings() {
-        for (std::string file_name : getLuaFils()) {
-            LuaScriptData luae = getLuas()[file_name];
-            if (luae.start) {
-                sol::state_view lua(luae.L);
-                sol_ImGui::Init(lua);
-            }
+    inline void Imgui_Bindings(const std::vector<lua_State*>& states) {
+        for (lua_State* L : states) {
+            sol::state_view lua(L);
+            sol_ImGui::Init(lua);
         }
         initUI = true;
     }
@@ -4,18 +4,46 @@
 
 #include <imgui.h>
 #include <imgui_internal.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <sol/sol.hpp>
 
+// sol reads a const char* with lua_tolstring, which gives NULL for nil. Read nil as "" instead
+// so ImGui.Text(nil) can't hand ImGui a null pointer, and let overloads taking a string accept
+// nil the same way.
+namespace sol
+{
+	inline const char* sol_lua_get(types<const char*>, lua_State* L, int index, stack::record& tracking) {
+		tracking.use(1);
+		const char* s = lua_tostring(L, index);
+		return s ? s : "";
+	}
+
+	template <typename Handler>
+	inline bool sol_lua_check(types<const char*>, lua_State* L, int index, Handler&& handler, stack::record& tracking) {
+		tracking.use(1);
+		const int t = lua_type(L, index);
+		if (t == LUA_TSTRING || t == LUA_TNIL || t == LUA_TNONE)
+			return true;
+		handler(L, index, type::string, static_cast<type>(t), "expected a string or nil");
+		return false;
+	}
+}
+
+// String arguments are taken as const char* borrowed straight from the Lua stack, so a call
+// never copies a label or ID into a std::string. Don't keep them past the call.
 namespace sol_ImGui
 {
 	// Windows
-	inline bool Begin(const std::string& name)															{ return ImGui::Begin(name.c_str()); }
-	inline std::tuple<bool, bool> Begin(const std::string& name, bool open)
+	inline bool Begin(const char* name)																	{ return ImGui::Begin(name); }
+	inline std::tuple<bool, bool> Begin(const char* name, bool open)
 	{
 		if (!open) return std::make_tuple(false, false);
 
-		bool shouldDraw = ImGui::Begin(name.c_str(), &open);
+		bool shouldDraw = ImGui::Begin(name, &open);
 
 		if(!open)
 		{
@@ -25,10 +53,10 @@ namespace sol_ImGui
 		
 		return std::make_tuple(open, shouldDraw);
 	}
-	inline std::tuple<bool, bool> Begin(const std::string& name, bool open, int flags)
+	inline std::tuple<bool, bool> Begin(const char* name, bool open, int flags)
 	{
 		if (!open) return std::make_tuple(false, false);
-		bool shouldDraw = ImGui::Begin(name.c_str(), &open, static_cast<ImGuiWindowFlags_>(flags));
+		bool shouldDraw = ImGui::Begin(name, &open, static_cast<ImGuiWindowFlags_>(flags));
 
 		if(!open)
 		{
@@ -43,11 +71,11 @@ namespace sol_ImGui
 	inline std::tuple<float, float> GetDisplaySize()													{ const ImGuiIO io = ImGui::GetIO();  return std::make_tuple(io.DisplaySize.x, io.DisplaySize.y); }
 
 	// Child Windows
-	inline bool BeginChild(const std::string& name)														{ return ImGui::BeginChild(name.c_str()); }
-	inline bool BeginChild(const std::string& name, float sizeX)										{ return ImGui::BeginChild(name.c_str(), { sizeX, 0 }); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY)							{ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, bool border)				{ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, border); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, bool border, int flags)	{ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, border, static_cast<ImGuiWindowFlags>(flags)); }
+	inline bool BeginChild(const char* name)															{ return ImGui::BeginChild(name); }
+	inline bool BeginChild(const char* name, float sizeX)												{ return ImGui::BeginChild(name, { sizeX, 0 }); }
+	inline bool BeginChild(const char* name, float sizeX, float sizeY)									{ return ImGui::BeginChild(name, { sizeX, sizeY }); }
+	inline bool BeginChild(const char* name, float sizeX, float sizeY, bool border)						{ return ImGui::BeginChild(name, { sizeX, sizeY }, border); }
+	inline bool BeginChild(const char* name, float sizeX, float sizeY, bool border, int flags)			{ return ImGui::BeginChild(name, { sizeX, sizeY }, border, static_cast<ImGuiWindowFlags>(flags)); }
 	inline void EndChild()																				{ ImGui::EndChild(); }
 
 	// Windows Utilities
@@ -84,13 +112,13 @@ namespace sol_ImGui
 	inline void SetWindowCollapsed(bool collapsed, int cond)											{ ImGui::SetWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond)); }
 	inline void SetWindowFocus()																		{ ImGui::SetWindowFocus(); }
 	inline void SetWindowFontScale(float scale)															{ ImGui::SetWindowFontScale(scale); }
-	inline void SetWindowPos(const std::string& name, float posX, float posY)							{ ImGui::SetWindowPos(name.c_str(), { posX, posY }); }
-	inline void SetWindowPos(const std::string& name, float posX, float posY, int cond)					{ ImGui::SetWindowPos(name.c_str(), { posX, posY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY)						{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }); }
-	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY, int cond)				{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowCollapsed(const std::string& name, bool collapsed)								{ ImGui::SetWindowCollapsed(name.c_str(), collapsed); }
-	inline void SetWindowCollapsed(const std::string& name, bool collapsed, int cond)					{ ImGui::SetWindowCollapsed(name.c_str(), collapsed, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowFocus(const std::string& name)													{ ImGui::SetWindowFocus(name.c_str()); }
+	inline void SetWindowPos(const char* name, float posX, float posY)									{ ImGui::SetWindowPos(name, { posX, posY }); }
+	inline void SetWindowPos(const char* name, float posX, float posY, int cond)						{ ImGui::SetWindowPos(name, { posX, posY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowSize(const char* name, float sizeX, float sizeY)								{ ImGui::SetWindowSize(name, { sizeX, sizeY }); }
+	inline void SetWindowSize(const char* name, float sizeX, float sizeY, int cond)						{ ImGui::SetWindowSize(name, { sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowCollapsed(const char* name, bool collapsed)									{ ImGui::SetWindowCollapsed(name, collapsed); }
+	inline void SetWindowCollapsed(const char* name, bool collapsed, int cond)							{ ImGui::SetWindowCollapsed(name, collapsed, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowFocus(const char* name)														{ ImGui::SetWindowFocus(name); }
 
 	// Content Region
 	inline std::tuple<float, float> GetContentRegionMax()												{ const auto vec2{ ImGui::GetContentRegionMax() };  return std::make_tuple(vec2.x, vec2.y); }
@@ -181,56 +209,201 @@ namespace sol_ImGui
 	inline float GetFrameHeightWithSpacing()															{ return ImGui::GetFrameHeightWithSpacing(); }
 
 	// ID stack / scopes
-	inline void PushID(const std::string& stringID)														{ ImGui::PushID(stringID.c_str()); }
-	inline void PushID(const std::string& stringIDBegin, const std::string& stringIDEnd)				{ ImGui::PushID(stringIDBegin.c_str(), stringIDEnd.c_str()); }
+	inline void PushID(const char* stringID)															{ ImGui::PushID(stringID); }
+	inline void PushID(const char* stringIDBegin, const char* stringIDEnd)								{ ImGui::PushID(stringIDBegin, stringIDEnd); }
 	inline void PushID(const void*)																		{ /* TODO: PushID(void*) ==> UNSUPPORTED */ }
 	inline void PushID(int intID)																		{ ImGui::PushID(intID); }
 	inline void PopID()																					{ ImGui::PopID(); }
-	inline int GetID(const std::string& stringID)														{ return ImGui::GetID(stringID.c_str()); }
-	inline int GetID(const std::string& stringIDBegin, const std::string& stringIDEnd)					{ return ImGui::GetID(stringIDBegin.c_str(), stringIDEnd.c_str()); }
+	inline int GetID(const char* stringID)																{ return ImGui::GetID(stringID); }
+	inline int GetID(const char* stringIDBegin, const char* stringIDEnd)								{ return ImGui::GetID(stringIDBegin, stringIDEnd); }
 	inline int GetID(const void*)																		{ return 0;  /* TODO: GetID(void*) ==> UNSUPPORTED */ }
 
 	// Widgets: Text
-	inline void TextUnformatted(const std::string& text)												{ ImGui::TextUnformatted(text.c_str()); }
-	inline void TextUnformatted(const std::string& text, const std::string& textEnd)					{ ImGui::TextUnformatted(text.c_str(), textEnd.c_str()); }
-	inline void Text(const std::string& text)															{ ImGui::Text(text.c_str()); }
-	inline void TextColored(float colR, float colG, float colB, float colA, const std::string& text)	{ ImGui::TextColored({ colR, colG, colB, colA }, text.c_str()); }
-	inline void TextDisabled(const std::string& text)													{ ImGui::TextDisabled(text.c_str()); }
-	inline void TextWrapped(const std::string text)														{ ImGui::TextWrapped(text.c_str()); }
-	inline void LabelText(const std::string& label, const std::string& text)							{ ImGui::LabelText(label.c_str(), text.c_str()); }
-	inline void BulletText(const std::string& text)														{ ImGui::BulletText(text.c_str()); }
+	// Script text is always drawn verbatim, so '%' and "%%" come out exactly as written. Formatting
+	// is opt-in through the *F variants below.
+	inline void TextUnformatted(const char* text)														{ ImGui::TextUnformatted(text); }
+	inline void TextUnformatted(const char* text, const char* textEnd)									{ ImGui::TextUnformatted(text, textEnd); }
+	inline void Text(const char* text)																	{ ImGui::TextUnformatted(text); }
+	inline void TextColored(float colR, float colG, float colB, float colA, const char* text)			{ ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(colR, colG, colB, colA)); ImGui::TextUnformatted(text); ImGui::PopStyleColor(); }
+	inline void TextDisabled(const char* text)															{ ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]); ImGui::TextUnformatted(text); ImGui::PopStyleColor(); }
+	inline void TextWrapped(const char* text)
+	{
+		// Same as ImGui::TextWrapped: wrap at the window edge unless a wrap position is already set
+		const bool push = ImGui::GetCurrentWindow()->DC.TextWrapPos < 0.0f;
+		if (push)
+			ImGui::PushTextWrapPos(0.0f);
+		ImGui::TextUnformatted(text);
+		if (push)
+			ImGui::PopTextWrapPos();
+	}
+	inline void LabelText(const char* label, const char* text)											{ ImGui::LabelText(label, "%s", text); }
+	inline void BulletText(const char* text)															{ ImGui::BulletText("%s", text); }
+
+	// Widgets: Formatted Text
+	// string.format-style formatting done in C++ from the raw Lua arguments, so no Lua string is
+	// created per call. Output goes to a scratch buffer that is recycled every frame.
+	struct FormatScratch
+	{
+		std::vector<char> buffer;
+		int frame = -1;
+	};
+	inline std::vector<char>& GetFormatScratch()
+	{
+		static FormatScratch scratch;
+		if (scratch.frame != ImGui::GetFrameCount())
+		{
+			scratch.frame = ImGui::GetFrameCount();
+			scratch.buffer.clear();
+		}
+		return scratch.buffer;
+	}
+	template<typename T>
+	inline void AppendFormatted(std::vector<char>& out, const char* spec, T value)
+	{
+		const size_t offset = out.size();
+		out.resize(offset + 64);
+		int len = std::snprintf(out.data() + offset, 64, spec, value);
+		if (len >= 64)
+		{
+			out.resize(offset + len + 1);
+			std::snprintf(out.data() + offset, len + 1, spec, value);
+		}
+		out.resize(offset + (len > 0 ? len : 0));
+	}
+	inline void AppendArgument(std::vector<char>& out, lua_State* L, int index, const char* spec, char conversion)
+	{
+		char tmp[64];
+		switch (conversion)
+		{
+		case 'd': case 'i': case 'o': case 'u': case 'x': case 'X': {
+			const lua_Integer value = lua_isinteger(L, index) ? lua_tointeger(L, index) : static_cast<lua_Integer>(lua_tonumber(L, index));
+			AppendFormatted(out, spec, static_cast<long long>(value));
+			break;
+		}
+		case 'c':
+			AppendFormatted(out, spec, static_cast<int>(lua_tointeger(L, index)));
+			break;
+		case 'a': case 'A': case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+			AppendFormatted(out, spec, static_cast<double>(lua_tonumber(L, index)));
+			break;
+		default: {
+			const char* str = tmp;
+			switch (lua_type(L, index))
+			{
+			case LUA_TSTRING:	str = lua_tostring(L, index); break;
+			case LUA_TNUMBER:
+				if (lua_isinteger(L, index))	std::snprintf(tmp, sizeof(tmp), "%lld", static_cast<long long>(lua_tointeger(L, index)));
+				else							std::snprintf(tmp, sizeof(tmp), "%.14g", static_cast<double>(lua_tonumber(L, index)));
+				break;
+			case LUA_TBOOLEAN:	str = lua_toboolean(L, index) ? "true" : "false"; break;
+			case LUA_TNIL:
+			case LUA_TNONE:		str = "nil"; break;
+			default:			std::snprintf(tmp, sizeof(tmp), "%s: %p", luaL_typename(L, index), lua_topointer(L, index)); break;
+			}
+			AppendFormatted(out, spec, str);
+			break;
+		}
+		}
+	}
+	// Returns a NUL-terminated [begin, end) range that stays valid until the next call.
+	inline std::pair<const char*, const char*> FormatArgs(const char* fmt, const sol::variadic_args& args)
+	{
+		std::vector<char>& out = GetFormatScratch();
+		const size_t begin = out.size();
+		lua_State* L = args.lua_state();
+		int index = args.stack_index();
+		const int last = index + static_cast<int>(args.size());
+
+		for (const char* p = fmt; *p; p++)
+		{
+			if (*p != '%')
+			{
+				out.push_back(*p);
+				continue;
+			}
+			if (p[1] == '%')
+			{
+				out.push_back('%');
+				p++;
+				continue;
+			}
+
+			// %[flags][width][.precision]conversion, with a length modifier inserted for integers
+			char spec[32] = { '%' };
+			size_t n = 1;
+			const char* q = p + 1;
+			while (*q && std::strchr("-+ #0123456789.", *q) && n < sizeof(spec) - 4)
+				spec[n++] = *q++;
+			if (!*q)
+				break;
+			const char conversion = *q;
+			if (std::strchr("dioxXu", conversion))
+			{
+				spec[n++] = 'l';
+				spec[n++] = 'l';
+			}
+			spec[n++] = std::strchr("aAcdeEfFgGiouxX", conversion) ? conversion : 's';
+			spec[n] = '\0';
+
+			// Missing arguments format as nil
+			AppendArgument(out, L, index < last ? index : lua_gettop(L) + 1, spec, conversion);
+			index++;
+			p = q;
+		}
+
+		out.push_back('\0');
+		return { out.data() + begin, out.data() + out.size() - 1 };
+	}
+	inline void TextF(const char* fmt, sol::variadic_args args)										{ const auto text{ FormatArgs(fmt, args) }; ImGui::TextUnformatted(text.first, text.second); }
+	inline void LabelTextF(const char* label, const char* fmt, sol::variadic_args args)				{ const auto text{ FormatArgs(fmt, args) }; ImGui::LabelText(label, "%s", text.first); }
+	inline void BulletTextF(const char* fmt, sol::variadic_args args)								{ const auto text{ FormatArgs(fmt, args) }; ImGui::BulletText("%s", text.first); }
 
 	// Widgets: Main
-	inline bool Button(const std::string& label)														{ return ImGui::Button(label.c_str()); }
-	inline bool Button(const std::string& label, float sizeX, float sizeY)								{ return ImGui::Button(label.c_str(), { sizeX, sizeY }); }
-	inline bool SmallButton(const std::string& label)													{ return ImGui::SmallButton(label.c_str()); }
-	inline bool InvisibleButton(const std::string& stringID, float sizeX, float sizeY)					{ return ImGui::InvisibleButton(stringID.c_str(), { sizeX, sizeY }); }
-	inline bool ArrowButton(const std::string& stringID, int dir)										{ return ImGui::ArrowButton(stringID.c_str(), static_cast<ImGuiDir>(dir)); }
-	inline void Image(long long texture, int width, int height)											{ ImGui::Image((void*)texture, ImVec2(width, height)); }
-	inline void Image(long long texture, int width, int height, float alpha)							{ ImGui::Image((void*)texture, ImVec2(width, height), ImVec2(0, 0), ImVec2(1.0, 1.0), ImVec4(1.0, 1.0, 1.0, alpha)); }
+	inline bool Button(const char* label)																{ return ImGui::Button(label); }
+	inline bool Button(const char* label, float sizeX, float sizeY)										{ return ImGui::Button(label, { sizeX, sizeY }); }
+	inline bool SmallButton(const char* label)															{ return ImGui::SmallButton(label); }
+	inline bool InvisibleButton(const char* stringID, float sizeX, float sizeY)							{ return ImGui::InvisibleButton(stringID, { sizeX, sizeY }); }
+	inline bool ArrowButton(const char* stringID, int dir)												{ return ImGui::ArrowButton(stringID, static_cast<ImGuiDir>(dir)); }
+	// Maps a script's texture handle to an ImTextureID and the uv rect (x0, y0, x1, y1) it covers;
+	// false while the texture isn't ready. `size` is what the whole texture would be drawn at.
+	inline bool(*ResolveTexture)(long long texture, const ImVec2& size, ImTextureID& id, ImVec4& uv) = nullptr;
+	inline void Image(long long texture, const ImVec2& size, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& tint)
+	{
+		ImTextureID id{ (ImTextureID)texture };
+		ImVec4 rect{ 0.0f, 0.0f, 1.0f, 1.0f };
+		// A texture still loading keeps its place in the layout
+		const ImVec2 span{ std::fabs(uv1.x - uv0.x), std::fabs(uv1.y - uv0.y) };
+		const ImVec2 full{ span.x > 0.0f ? size.x / span.x : size.x, span.y > 0.0f ? size.y / span.y : size.y };
+		if (ResolveTexture && !ResolveTexture(texture, full, id, rect)) { ImGui::Dummy(size); return; }
+		// uv is relative to the handle's part of the texture, e.g. an icon in an atlas
+		const ImVec2 scale{ rect.z - rect.x, rect.w - rect.y };
+		ImGui::Image(id, size, ImVec2(rect.x + uv0.x * scale.x, rect.y + uv0.y * scale.y), ImVec2(rect.x + uv1.x * scale.x, rect.y + uv1.y * scale.y), tint);
+	}
+	inline void Image(long long texture, int width, int height)											{ Image(texture, ImVec2(width, height), ImVec2(0, 0), ImVec2(1.0, 1.0), ImVec4(1.0, 1.0, 1.0, 1.0)); }
+	inline void Image(long long texture, int width, int height, float alpha)							{ Image(texture, ImVec2(width, height), ImVec2(0, 0), ImVec2(1.0, 1.0), ImVec4(1.0, 1.0, 1.0, alpha)); }
 	inline void Image(long long texture, int width, int height, 
-		float uv0_x, float uv0_y, float uv1_x, float uv1_y, float R, float G, float B, float alpha)		{ ImGui::Image((void*)texture, ImVec2(width, height), ImVec2(uv0_x, uv0_y), ImVec2(uv1_x, uv1_y), ImVec4(R, G, B, alpha)); }
+		float uv0_x, float uv0_y, float uv1_x, float uv1_y, float R, float G, float B, float alpha)		{ Image(texture, ImVec2(width, height), ImVec2(uv0_x, uv0_y), ImVec2(uv1_x, uv1_y), ImVec4(R, G, B, alpha)); }
 	inline void ImageButton()																			{ /* TODO: ImageButton(...) ==> UNSUPPORTED */ }
-	inline std::tuple<bool, bool> Checkbox(const std::string& label, bool v)
+	inline std::tuple<bool, bool> Checkbox(const char* label, bool v)
 	{
 		bool value{ v };
-		bool pressed = ImGui::Checkbox(label.c_str(), &value);
+		bool pressed = ImGui::Checkbox(label, &value);
 
 		return std::make_tuple(value, pressed);
 	}
 	inline bool CheckboxFlags()																			{ return false; /* TODO: CheckboxFlags(...) ==> UNSUPPORTED */ }
-	inline bool RadioButton(const std::string& label, bool active)										{ return ImGui::RadioButton(label.c_str(), active); }
-	inline std::tuple<int, bool> RadioButton(const std::string& label, int v, int vButton)				{ bool ret{ ImGui::RadioButton(label.c_str(), &v, vButton) }; return std::make_tuple(v, ret); }
+	inline bool RadioButton(const char* label, bool active)												{ return ImGui::RadioButton(label, active); }
+	inline std::tuple<int, bool> RadioButton(const char* label, int v, int vButton)						{ bool ret{ ImGui::RadioButton(label, &v, vButton) }; return std::make_tuple(v, ret); }
 	inline void ProgressBar(float fraction)																{ ImGui::ProgressBar(fraction); }
 	inline void ProgressBar(float fraction, float sizeX, float sizeY)									{ ImGui::ProgressBar(fraction, { sizeX, sizeY }); }
-	inline void ProgressBar(float fraction, float sizeX, float sizeY, const std::string& overlay)		{ ImGui::ProgressBar(fraction, { sizeX, sizeY }, overlay.c_str()); }
+	inline void ProgressBar(float fraction, float sizeX, float sizeY, const char* overlay)				{ ImGui::ProgressBar(fraction, { sizeX, sizeY }, overlay); }
 	inline void Bullet()																				{ ImGui::Bullet(); }
 
 	// Widgets: Combo Box
-	inline bool BeginCombo(const std::string& label, const std::string& previewValue)					{ return ImGui::BeginCombo(label.c_str(), previewValue.c_str()); }
-	inline bool BeginCombo(const std::string& label, const std::string& previewValue, int flags)		{ return ImGui::BeginCombo(label.c_str(), previewValue.c_str(), static_cast<ImGuiComboFlags>(flags)); }
+	inline bool BeginCombo(const char* label, const char* previewValue)									{ return ImGui::BeginCombo(label, previewValue); }
+	inline bool BeginCombo(const char* label, const char* previewValue, int flags)						{ return ImGui::BeginCombo(label, previewValue, static_cast<ImGuiComboFlags>(flags)); }
 	inline void EndCombo()																				{ ImGui::EndCombo(); }
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount)
+	inline std::tuple<int, bool> Combo(const char* label, int currentItem, const sol::table& items, int itemsCount)
 	{
 		std::vector<std::string> strings;
 		for (int i{ 1 }; i <= itemsCount; i++)
@@ -243,10 +416,10 @@ namespace sol_ImGui
 		for (auto& string : strings)
 			cstrings.push_back(string.c_str());
 			
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount);
+		bool clicked = ImGui::Combo(label, &currentItem, cstrings.data(), itemsCount);
 		return std::make_tuple(currentItem, clicked);
 	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount, int popupMaxHeightInItems)
+	inline std::tuple<int, bool> Combo(const char* label, int currentItem, const sol::table& items, int itemsCount, int popupMaxHeightInItems)
 	{
 		std::vector<std::string> strings;
 		for (int i{ 1 }; i <= itemsCount; i++)
@@ -259,34 +432,34 @@ namespace sol_ImGui
 		for (auto& string : strings)
 			cstrings.push_back(string.c_str());
 
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount, popupMaxHeightInItems);
+		bool clicked = ImGui::Combo(label, &currentItem, cstrings.data(), itemsCount, popupMaxHeightInItems);
 		return std::make_tuple(currentItem, clicked);
 	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros)
+	inline std::tuple<int, bool> Combo(const char* label, int currentItem, const char* itemsSeparatedByZeros)
 	{
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str());
+		bool clicked = ImGui::Combo(label, &currentItem, itemsSeparatedByZeros);
 		return std::make_tuple(currentItem, clicked);
 	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros, int popupMaxHeightInItems)
+	inline std::tuple<int, bool> Combo(const char* label, int currentItem, const char* itemsSeparatedByZeros, int popupMaxHeightInItems)
 	{
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str(), popupMaxHeightInItems);
+		bool clicked = ImGui::Combo(label, &currentItem, itemsSeparatedByZeros, popupMaxHeightInItems);
 		return std::make_tuple(currentItem, clicked);
 	}
 	// TODO: 3rd Combo from ImGui not Supported
 
 	// Widgets: Drags
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v)																											{ bool used = ImGui::DragFloat(label.c_str(), &v); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed)																							{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min)																				{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max)																{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format)										{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format, float power)						{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str(), power); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v)
+	inline std::tuple<float, bool> DragFloat(const char* label, float v)																												{ bool used = ImGui::DragFloat(label, &v); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const char* label, float v, float v_speed)																									{ bool used = ImGui::DragFloat(label, &v, v_speed); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const char* label, float v, float v_speed, float v_min)																					{ bool used = ImGui::DragFloat(label, &v, v_speed, v_min); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const char* label, float v, float v_speed, float v_min, float v_max)																		{ bool used = ImGui::DragFloat(label, &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const char* label, float v, float v_speed, float v_min, float v_max, const char* format)													{ bool used = ImGui::DragFloat(label, &v, v_speed, v_min, v_max, format); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const char* label, float v, float v_speed, float v_min, float v_max, const char* format, float power)										{ bool used = ImGui::DragFloat(label, &v, v_speed, v_min, v_max, format, power); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value);
+		bool used = ImGui::DragFloat2(label, value);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -294,12 +467,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed);
+		bool used = ImGui::DragFloat2(label, value, v_speed);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -307,12 +480,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v, float v_speed, float v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragFloat2(label, value, v_speed, v_min);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -320,12 +493,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v, float v_speed, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragFloat2(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -333,12 +506,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragFloat2(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -346,12 +519,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::DragFloat2(label, value, v_speed, v_min, v_max, format, power);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -359,13 +532,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value);
+		bool used = ImGui::DragFloat3(label, value);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -373,13 +546,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed);
+		bool used = ImGui::DragFloat3(label, value, v_speed);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -387,13 +560,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v, float v_speed, float v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragFloat3(label, value, v_speed, v_min);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -401,13 +574,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v, float v_speed, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragFloat3(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -415,13 +588,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragFloat3(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -429,13 +602,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::DragFloat3(label, value, v_speed, v_min, v_max, format, power);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -443,14 +616,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value);
+		bool used = ImGui::DragFloat4(label, value);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -458,14 +631,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed);
+		bool used = ImGui::DragFloat4(label, value, v_speed);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -473,14 +646,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v, float v_speed, float v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragFloat4(label, value, v_speed, v_min);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -488,14 +661,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v, float v_speed, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragFloat4(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -503,14 +676,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragFloat4(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -518,14 +691,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const char* label, const sol::table& v, float v_speed, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::DragFloat4(label, value, v_speed, v_min, v_max, format, power);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -534,17 +707,17 @@ namespace sol_ImGui
 		return std::make_tuple(float4, used);
 	}
 	inline void DragFloatRange2()																																						{ /* TODO: DragFloatRange2(...) ==> UNSUPPORTED */ }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v)																												{ bool used = ImGui::DragInt(label.c_str(), &v); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed)																								{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min)																						{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max)																			{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max, const std::string& format)												{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v)
+	inline std::tuple<int, bool> DragInt(const char* label, int v)																														{ bool used = ImGui::DragInt(label, &v); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const char* label, int v, float v_speed)																										{ bool used = ImGui::DragInt(label, &v, v_speed); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const char* label, int v, float v_speed, int v_min)																							{ bool used = ImGui::DragInt(label, &v, v_speed, v_min); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const char* label, int v, float v_speed, int v_min, int v_max)																					{ bool used = ImGui::DragInt(label, &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const char* label, int v, float v_speed, int v_min, int v_max, const char* format)																{ bool used = ImGui::DragInt(label, &v, v_speed, v_min, v_max, format); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value);
+		bool used = ImGui::DragInt2(label, value);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -552,12 +725,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed);
+		bool used = ImGui::DragInt2(label, value, v_speed);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -565,12 +738,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const char* label, const sol::table& v, float v_speed, int v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragInt2(label, value, v_speed, v_min);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -578,12 +751,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const char* label, const sol::table& v, float v_speed, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragInt2(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -591,12 +764,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const char* label, const sol::table& v, float v_speed, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragInt2(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -604,13 +777,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value);
+		bool used = ImGui::DragInt3(label, value);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -618,13 +791,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed);
+		bool used = ImGui::DragInt3(label, value, v_speed);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -632,13 +805,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const char* label, const sol::table& v, float v_speed, int v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragInt3(label, value, v_speed, v_min);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -646,13 +819,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const char* label, const sol::table& v, float v_speed, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragInt3(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -660,13 +833,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const char* label, const sol::table& v, float v_speed, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragInt3(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -674,14 +847,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value);
+		bool used = ImGui::DragInt4(label, value);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -689,14 +862,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const char* label, const sol::table& v, float v_speed)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed);
+		bool used = ImGui::DragInt4(label, value, v_speed);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -704,14 +877,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const char* label, const sol::table& v, float v_speed, int v_min)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min);
+		bool used = ImGui::DragInt4(label, value, v_speed, v_min);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -719,14 +892,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const char* label, const sol::table& v, float v_speed, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max);
+		bool used = ImGui::DragInt4(label, value, v_speed, v_min, v_max);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -734,14 +907,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const char* label, const sol::table& v, float v_speed, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		bool used = ImGui::DragInt4(label, value, v_speed, v_min, v_max, format);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -754,15 +927,15 @@ namespace sol_ImGui
 	inline void DragScalarN()																																							{ /* TODO: DragScalarN(...) ==> UNSUPPORTED */ }
 
 	// Widgets: Sliders
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max)																				{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format)													{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format, float power)										{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str(), power); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max)
+	inline std::tuple<float, bool> SliderFloat(const char* label, float v, float v_min, float v_max)																					{ bool used = ImGui::SliderFloat(label, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> SliderFloat(const char* label, float v, float v_min, float v_max, const char* format)																{ bool used = ImGui::SliderFloat(label, &v, v_min, v_max, format); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> SliderFloat(const char* label, float v, float v_min, float v_max, const char* format, float power)													{ bool used = ImGui::SliderFloat(label, &v, v_min, v_max, format, power); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const char* label, const sol::table& v, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderFloat2(label, value, v_min, v_max);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -770,12 +943,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const char* label, const sol::table& v, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderFloat2(label, value, v_min, v_max, format);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -783,12 +956,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const char* label, const sol::table& v, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::SliderFloat2(label, value, v_min, v_max, format, power);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -796,13 +969,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const char* label, const sol::table& v, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderFloat3(label, value, v_min, v_max);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[3]
@@ -810,13 +983,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const char* label, const sol::table& v, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderFloat3(label, value, v_min, v_max, format);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[3]
@@ -824,13 +997,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const char* label, const sol::table& v, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::SliderFloat3(label, value, v_min, v_max, format, power);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[3]
@@ -838,14 +1011,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const char* label, const sol::table& v, float v_min, float v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderFloat4(label, value, v_min, v_max);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -853,14 +1026,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const char* label, const sol::table& v, float v_min, float v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderFloat4(label, value, v_min, v_max, format);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -868,14 +1041,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, float power)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const char* label, const sol::table& v, float v_min, float v_max, const char* format, float power)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str(), power);
+		bool used = ImGui::SliderFloat4(label, value, v_min, v_max, format, power);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -883,18 +1056,18 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad)																									{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min)																				{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max)															{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max, const std::string& format)								{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max, format.c_str()); return std::make_tuple(v_rad, used); }
-	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max)																						{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max, const std::string& format)															{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max)
+	inline std::tuple<float, bool> SliderAngle(const char* label, float v_rad)																											{ bool used = ImGui::SliderAngle(label, &v_rad); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const char* label, float v_rad, float v_degrees_min)																						{ bool used = ImGui::SliderAngle(label, &v_rad, v_degrees_min); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const char* label, float v_rad, float v_degrees_min, float v_degrees_max)																{ bool used = ImGui::SliderAngle(label, &v_rad, v_degrees_min, v_degrees_max); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const char* label, float v_rad, float v_degrees_min, float v_degrees_max, const char* format)											{ bool used = ImGui::SliderAngle(label, &v_rad, v_degrees_min, v_degrees_max, format); return std::make_tuple(v_rad, used); }
+	inline std::tuple<int, bool> SliderInt(const char* label, int v, int v_min, int v_max)																								{ bool used = ImGui::SliderInt(label, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> SliderInt(const char* label, int v, int v_min, int v_max, const char* format)																			{ bool used = ImGui::SliderInt(label, &v, v_min, v_max, format); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const char* label, const sol::table& v, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderInt2(label, value, v_min, v_max);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -902,12 +1075,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const char* label, const sol::table& v, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderInt2(label, value, v_min, v_max, format);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -915,13 +1088,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const char* label, const sol::table& v, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderInt3(label, value, v_min, v_max);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -929,13 +1102,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const char* label, const sol::table& v, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderInt3(label, value, v_min, v_max, format);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -943,14 +1116,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const char* label, const sol::table& v, int v_min, int v_max)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max);
+		bool used = ImGui::SliderInt4(label, value, v_min, v_max);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -958,14 +1131,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const char* label, const sol::table& v, int v_min, int v_max, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max, format.c_str());
+		bool used = ImGui::SliderInt4(label, value, v_min, v_max, format);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -975,32 +1148,32 @@ namespace sol_ImGui
 	}
 	inline void SliderScalar()																																							{ /* TODO: SliderScalar(...) ==> UNSUPPORTED */ }
 	inline void SliderScalarN()																																							{ /* TODO: SliderScalarN(...) ==> UNSUPPORTED */ }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max)													{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format)						{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format, int flags)			{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str(), static_cast<ImGuiSliderFlags>(flags)); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max)															{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max, const std::string& format)									{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> VSliderFloat(const char* label, float sizeX, float sizeY, float v, float v_min, float v_max)															{ bool used = ImGui::VSliderFloat(label, { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> VSliderFloat(const char* label, float sizeX, float sizeY, float v, float v_min, float v_max, const char* format)										{ bool used = ImGui::VSliderFloat(label, { sizeX, sizeY }, &v, v_min, v_max, format); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> VSliderFloat(const char* label, float sizeX, float sizeY, float v, float v_min, float v_max, const char* format, int flags)							{ bool used = ImGui::VSliderFloat(label, { sizeX, sizeY }, &v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> VSliderInt(const char* label, float sizeX, float sizeY, int v, int v_min, int v_max)																	{ bool used = ImGui::VSliderInt(label, { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> VSliderInt(const char* label, float sizeX, float sizeY, int v, int v_min, int v_max, const char* format)												{ bool used = ImGui::VSliderInt(label, { sizeX, sizeY }, &v, v_min, v_max, format); return std::make_tuple(v, used); }
 	inline void VSliderScalar()																																							{ /* TODO: VSliderScalar(...) ==> UNSUPPORTED */ }
 
 	// Widgets: Input with Keyboard
-	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text, unsigned int buf_size)																	{ bool selected = ImGui::InputText(label.c_str(), &text[0], buf_size); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text, unsigned int buf_size, int flags)														{ bool selected = ImGui::InputText(label.c_str(), &text[0], buf_size, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, unsigned int buf_size)															{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text[0], buf_size); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, unsigned int buf_size, float sizeX, float sizeY)								{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text[0], buf_size, { sizeX, sizeY }); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, unsigned int buf_size, float sizeX, float sizeY, int flags)						{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text[0], buf_size, { sizeX, sizeY }, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text, unsigned int buf_size)									{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text[0], buf_size); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text, unsigned int buf_size, int flags)						{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text[0], buf_size, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v)																										{ bool selected = ImGui::InputFloat(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step)																							{ bool selected = ImGui::InputFloat(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast)																			{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format)												{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format, int flags)										{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v)
+	inline std::tuple<std::string, bool> InputText(const char* label, std::string text, unsigned int buf_size)																			{ bool selected = ImGui::InputText(label, &text[0], buf_size); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputText(const char* label, std::string text, unsigned int buf_size, int flags)																{ bool selected = ImGui::InputText(label, &text[0], buf_size, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const char* label, std::string text, unsigned int buf_size)																	{ bool selected = ImGui::InputTextMultiline(label, &text[0], buf_size); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const char* label, std::string text, unsigned int buf_size, float sizeX, float sizeY)										{ bool selected = ImGui::InputTextMultiline(label, &text[0], buf_size, { sizeX, sizeY }); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const char* label, std::string text, unsigned int buf_size, float sizeX, float sizeY, int flags)							{ bool selected = ImGui::InputTextMultiline(label, &text[0], buf_size, { sizeX, sizeY }, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextWithHint(const char* label, const char* hint, std::string text, unsigned int buf_size)												{ bool selected = ImGui::InputTextWithHint(label, hint, &text[0], buf_size); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextWithHint(const char* label, const char* hint, std::string text, unsigned int buf_size, int flags)										{ bool selected = ImGui::InputTextWithHint(label, hint, &text[0], buf_size, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<float, bool> InputFloat(const char* label, float v)																												{ bool selected = ImGui::InputFloat(label, &v); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const char* label, float v, float step)																									{ bool selected = ImGui::InputFloat(label, &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const char* label, float v, float step, float step_fast)																					{ bool selected = ImGui::InputFloat(label, &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const char* label, float v, float step, float step_fast, const char* format)																{ bool selected = ImGui::InputFloat(label, &v, step, step_fast, format); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const char* label, float v, float step, float step_fast, const char* format, int flags)													{ bool selected = ImGui::InputFloat(label, &v, step, step_fast, format, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value);
+		bool used = ImGui::InputFloat2(label, value);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -1008,12 +1181,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const char* label, const sol::table& v, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str());
+		bool used = ImGui::InputFloat2(label, value, format);
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -1021,12 +1194,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const char* label, const sol::table& v, const char* format, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputFloat2(label, value, format, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t float2 = sol::as_table(std::vector<float>{
 			value[0], value[1]
@@ -1034,13 +1207,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float2, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value);
+		bool used = ImGui::InputFloat3(label, value);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -1048,13 +1221,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const char* label, const sol::table& v, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str());
+		bool used = ImGui::InputFloat3(label, value, format);
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -1062,13 +1235,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const char* label, const sol::table& v, const char* format, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputFloat3(label, value, format, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t float3 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2]
@@ -1076,14 +1249,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float3, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value);
+		bool used = ImGui::InputFloat4(label, value);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -1091,14 +1264,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const char* label, const sol::table& v, const char* format)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str());
+		bool used = ImGui::InputFloat4(label, value, format);
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -1106,14 +1279,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const char* label, const sol::table& v, const char* format, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputFloat4(label, value, format, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t float4 = sol::as_table(std::vector<float>{
 			value[0], value[1], value[2], value[3]
@@ -1121,16 +1294,16 @@ namespace sol_ImGui
 
 		return std::make_tuple(float4, used);
 	}
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v)																												{ bool selected = ImGui::InputInt(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step)																									{ bool selected = ImGui::InputInt(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast)																						{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast, int flags)																			{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v)
+	inline std::tuple<int, bool> InputInt(const char* label, int v)																														{ bool selected = ImGui::InputInt(label, &v); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const char* label, int v, int step)																											{ bool selected = ImGui::InputInt(label, &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const char* label, int v, int step, int step_fast)																							{ bool selected = ImGui::InputInt(label, &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const char* label, int v, int step, int step_fast, int flags)																					{ bool selected = ImGui::InputInt(label, &v, step, step_fast, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::InputInt2(label.c_str(), value);
+		bool used = ImGui::InputInt2(label, value);
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -1138,12 +1311,12 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const char* label, const sol::table& v, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::InputInt2(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputInt2(label, value, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t int2 = sol::as_table(std::vector<int>{
 			value[0], value[1]
@@ -1151,13 +1324,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int2, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v)
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::InputInt3(label.c_str(), value);
+		bool used = ImGui::InputInt3(label, value);
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -1165,13 +1338,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const char* label, const sol::table& v, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::InputInt3(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputInt3(label, value, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t int3 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2]
@@ -1179,14 +1352,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int3, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v)
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const char* label, const sol::table& v)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::InputInt4(label.c_str(), value);
+		bool used = ImGui::InputInt4(label, value);
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -1194,14 +1367,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v, int flags)
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const char* label, const sol::table& v, int flags)
 	{
 		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::InputInt4(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+		bool used = ImGui::InputInt4(label, value, static_cast<ImGuiInputTextFlags>(flags));
 
 		sol::as_table_t int4 = sol::as_table(std::vector<int>{
 			value[0], value[1], value[2], value[3]
@@ -1209,22 +1382,22 @@ namespace sol_ImGui
 
 		return std::make_tuple(int4, used);
 	}
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v)																										{ bool selected = ImGui::InputDouble(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step)																						{ bool selected = ImGui::InputDouble(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast)																		{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format)											{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format, int flags)								{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const char* label, double v)																											{ bool selected = ImGui::InputDouble(label, &v); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const char* label, double v, double step)																								{ bool selected = ImGui::InputDouble(label, &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const char* label, double v, double step, double step_fast)																				{ bool selected = ImGui::InputDouble(label, &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const char* label, double v, double step, double step_fast, const char* format)															{ bool selected = ImGui::InputDouble(label, &v, step, step_fast, format); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const char* label, double v, double step, double step_fast, const char* format, int flags)												{ bool selected = ImGui::InputDouble(label, &v, step, step_fast, format, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
 	inline void InputScalar()																																							{ /* TODO: InputScalar(...) ==> UNSUPPORTED */ }
 	inline void InputScalarN()																																							{ /* TODO: InputScalarN(...) ==> UNSUPPORTED */ }
 
 	// Widgets: Color Editor / Picker
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const char* label, const sol::table& col)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 			b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorEdit3(label.c_str(), color);
+		bool used = ImGui::ColorEdit3(label, color);
 
 		sol::as_table_t rgb = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2]
@@ -1232,13 +1405,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgb, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col, int flags)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const char* label, const sol::table& col, int flags)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorEdit3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		bool used = ImGui::ColorEdit3(label, color, static_cast<ImGuiColorEditFlags>(flags));
 
 		sol::as_table_t rgb = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2]
@@ -1246,14 +1419,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgb, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const char* label, const sol::table& col)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorEdit4(label.c_str(), color);
+		bool used = ImGui::ColorEdit4(label, color);
 
 		sol::as_table_t rgba = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2], color[3]
@@ -1261,14 +1434,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgba, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col, int flags)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const char* label, const sol::table& col, int flags)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorEdit4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		bool used = ImGui::ColorEdit4(label, color, static_cast<ImGuiColorEditFlags>(flags));
 
 		sol::as_table_t rgba = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2], color[3]
@@ -1276,13 +1449,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgba, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const char* label, const sol::table& col)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorPicker3(label.c_str(), color);
+		bool used = ImGui::ColorPicker3(label, color);
 
 		sol::as_table_t rgb = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2]
@@ -1290,13 +1463,13 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgb, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col, int flags)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const char* label, const sol::table& col, int flags)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorPicker3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		bool used = ImGui::ColorPicker3(label, color, static_cast<ImGuiColorEditFlags>(flags));
 
 		sol::as_table_t rgb = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2]
@@ -1304,14 +1477,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgb, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const char* label, const sol::table& col)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorPicker4(label.c_str(), color);
+		bool used = ImGui::ColorPicker4(label, color);
 
 		sol::as_table_t rgba = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2], color[3]
@@ -1319,14 +1492,14 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgba, used);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col, int flags)
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const char* label, const sol::table& col, int flags)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorPicker4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		bool used = ImGui::ColorPicker4(label, color, static_cast<ImGuiColorEditFlags>(flags));
 
 		sol::as_table_t rgba = sol::as_table(std::vector<float>{
 			color[0], color[1], color[2], color[3]
@@ -1334,63 +1507,63 @@ namespace sol_ImGui
 
 		return std::make_tuple(rgba, used);
 	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col)
+	inline bool ColorButton(const char* desc_id, const sol::table& col)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color);
+		return ImGui::ColorButton(desc_id, color);
 	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags)
+	inline bool ColorButton(const char* desc_id, const sol::table& col, int flags)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		return ImGui::ColorButton(desc_id, color, static_cast<ImGuiColorEditFlags>(flags));
 	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags, float sizeX, float sizeY)
+	inline bool ColorButton(const char* desc_id, const sol::table& col, int flags, float sizeX, float sizeY)
 	{
 		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
 							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
 		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags), { sizeX, sizeY });
+		return ImGui::ColorButton(desc_id, color, static_cast<ImGuiColorEditFlags>(flags), { sizeX, sizeY });
 	}
 	inline void SetColorEditOptions(int flags)																																			{ ImGui::SetColorEditOptions(static_cast<ImGuiColorEditFlags>(flags)); }
 
 	// Widgets: Trees
-	inline bool TreeNode(const std::string& label)														{ return ImGui::TreeNode(label.c_str()); }
-	inline bool TreeNode(const std::string& label, const std::string& fmt)								{ return ImGui::TreeNode(label.c_str(), fmt.c_str()); }
+	inline bool TreeNode(const char* label)																{ return ImGui::TreeNode(label); }
+	inline bool TreeNode(const char* label, const char* fmt)											{ return ImGui::TreeNode(label, fmt); }
 	/* TODO: TreeNodeV(...) (2) ==> UNSUPPORTED */
-	inline bool TreeNodeEx(const std::string& label)													{ return ImGui::TreeNodeEx(label.c_str()); }
-	inline bool TreeNodeEx(const std::string& label, int flags)											{ return ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)); }
-	inline bool TreeNodeEx(const std::string& label, int flags, const std::string& fmt)					{ return ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags), fmt.c_str()); }
+	inline bool TreeNodeEx(const char* label)															{ return ImGui::TreeNodeEx(label); }
+	inline bool TreeNodeEx(const char* label, int flags)												{ return ImGui::TreeNodeEx(label, static_cast<ImGuiTreeNodeFlags>(flags)); }
+	inline bool TreeNodeEx(const char* label, int flags, const char* fmt)								{ return ImGui::TreeNodeEx(label, static_cast<ImGuiTreeNodeFlags>(flags), fmt); }
 	/* TODO: TreeNodeExV(...) (2) ==> UNSUPPORTED */
-	inline void TreePush(const std::string& str_id)														{ ImGui::TreePush(str_id.c_str()); }
+	inline void TreePush(const char* str_id)															{ ImGui::TreePush(str_id); }
 	/* TODO: TreePush(const void*) ==> UNSUPPORTED */
 	inline void TreePop()																				{ ImGui::TreePop(); }
 	inline float GetTreeNodeToLabelSpacing()															{ return ImGui::GetTreeNodeToLabelSpacing(); }
-	inline bool CollapsingHeader(const std::string& label)												{ return ImGui::CollapsingHeader(label.c_str()); }
-	inline bool CollapsingHeader(const std::string& label, int flags)									{ return ImGui::CollapsingHeader(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)); }
-	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open)					{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open); return std::make_tuple(open, notCollapsed); }
-	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open, int flags)		{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open, static_cast<ImGuiTreeNodeFlags>(flags)); return std::make_tuple(open, notCollapsed); }
+	inline bool CollapsingHeader(const char* label)														{ return ImGui::CollapsingHeader(label); }
+	inline bool CollapsingHeader(const char* label, int flags)											{ return ImGui::CollapsingHeader(label, static_cast<ImGuiTreeNodeFlags>(flags)); }
+	inline std::tuple<bool, bool> CollapsingHeader(const char* label, bool open)						{ bool notCollapsed = ImGui::CollapsingHeader(label, &open); return std::make_tuple(open, notCollapsed); }
+	inline std::tuple<bool, bool> CollapsingHeader(const char* label, bool open, int flags)				{ bool notCollapsed = ImGui::CollapsingHeader(label, &open, static_cast<ImGuiTreeNodeFlags>(flags)); return std::make_tuple(open, notCollapsed); }
 	inline void SetNextItemOpen(bool is_open)															{ ImGui::SetNextItemOpen(is_open); }
 	inline void SetNextItemOpen(bool is_open, int cond)													{ ImGui::SetNextItemOpen(is_open, static_cast<ImGuiCond>(cond)); }
 
 	// Widgets: Selectables
 	// TODO: Only one of Selectable variations is possible due to same parameters for Lua
-	inline bool Selectable(const std::string& label)													{ return ImGui::Selectable(label.c_str()); }
-	inline bool Selectable(const std::string& label, bool selected)										{ ImGui::Selectable(label.c_str(), &selected); return selected; }
-	inline bool Selectable(const std::string& label, bool selected, int flags)							{ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags)); return selected; }
-	inline bool Selectable(const std::string& label, bool selected, int flags, float sizeX, float sizeY){ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags), { sizeX, sizeY }); return selected; }
+	inline bool Selectable(const char* label)															{ return ImGui::Selectable(label); }
+	inline bool Selectable(const char* label, bool selected)											{ ImGui::Selectable(label, &selected); return selected; }
+	inline bool Selectable(const char* label, bool selected, int flags)									{ ImGui::Selectable(label, &selected, static_cast<ImGuiSelectableFlags>(flags)); return selected; }
+	inline bool Selectable(const char* label, bool selected, int flags, float sizeX, float sizeY){ ImGui::Selectable(label, &selected, static_cast<ImGuiSelectableFlags>(flags), { sizeX, sizeY }); return selected; }
 
 	// Widgets: List Boxes
-	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count)
+	inline std::tuple<int, bool> ListBox(const char* label, int current_item, const sol::table& items, int items_count)
 	{
 		std::vector<std::string> strings;
 		for (int i{ 1 }; i <= items_count; i++)
@@ -1403,10 +1576,10 @@ namespace sol_ImGui
 		for (auto& string : strings)
 			cstrings.push_back(string.c_str());
 
-		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count);
+		bool clicked = ImGui::ListBox(label, &current_item, cstrings.data(), items_count);
 		return std::make_tuple(current_item, clicked);
 	}
-	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count, int height_in_items)
+	inline std::tuple<int, bool> ListBox(const char* label, int current_item, const sol::table& items, int items_count, int height_in_items)
 	{
 		std::vector<std::string> strings;
 		for (int i{ 1 }; i <= items_count; i++)
@@ -1419,71 +1592,71 @@ namespace sol_ImGui
 		for (auto& string : strings)
 			cstrings.push_back(string.c_str());
 
-		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count, height_in_items);
+		bool clicked = ImGui::ListBox(label, &current_item, cstrings.data(), items_count, height_in_items);
 		return std::make_tuple(current_item, clicked);
 	}
-	inline bool BeginListBox(const std::string& label, float sizeX, float sizeY)						{ return ImGui::BeginListBox(label.c_str(), { sizeX, sizeY }); }
+	inline bool BeginListBox(const char* label, float sizeX, float sizeY)								{ return ImGui::BeginListBox(label, { sizeX, sizeY }); }
 	inline void EndListBox()																			{ ImGui::EndListBox(); }
 	
 	// Widgets: Data Plotting
 	/* TODO: Widgets Data Plotting ==> UNSUPPORTED (barely used and quite long functions) */
 
 	// Widgets: Value() helpers
-	inline void Value(const std::string& prefix, bool b)												{ ImGui::Value(prefix.c_str(), b); }
-	inline void Value(const std::string& prefix, int v)													{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, unsigned int v)										{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, float v)												{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, float v, const std::string& float_format)				{ ImGui::Value(prefix.c_str(), v, float_format.c_str()); }
+	inline void Value(const char* prefix, bool b)														{ ImGui::Value(prefix, b); }
+	inline void Value(const char* prefix, int v)														{ ImGui::Value(prefix, v); }
+	inline void Value(const char* prefix, unsigned int v)												{ ImGui::Value(prefix, v); }
+	inline void Value(const char* prefix, float v)														{ ImGui::Value(prefix, v); }
+	inline void Value(const char* prefix, float v, const char* float_format)							{ ImGui::Value(prefix, v, float_format); }
 
 	// Widgets: Menus
 	inline bool BeginMenuBar()																			{ return ImGui::BeginMenuBar(); }
 	inline void EndMenuBar()																			{ ImGui::EndMenuBar(); }
 	inline bool BeginMainMenuBar()																		{ return ImGui::BeginMainMenuBar(); }
 	inline void EndMainMenuBar()																		{ ImGui::EndMainMenuBar(); }
-	inline bool BeginMenu(const std::string& label)														{ return ImGui::BeginMenu(label.c_str()); }
-	inline bool BeginMenu(const std::string& label, bool enabled)										{ return ImGui::BeginMenu(label.c_str(), enabled); }
+	inline bool BeginMenu(const char* label)															{ return ImGui::BeginMenu(label); }
+	inline bool BeginMenu(const char* label, bool enabled)												{ return ImGui::BeginMenu(label, enabled); }
 	inline void EndMenu()																				{ ImGui::EndMenu(); }
-	inline bool MenuItem(const std::string& label)																					{ return ImGui::MenuItem(label.c_str()); }
-	inline bool MenuItem(const std::string& label, const std::string& shortcut)														{ return ImGui::MenuItem(label.c_str(), shortcut.c_str()); }
-	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected)					{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected); return std::make_tuple(selected, activated); }
-	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected, bool enabled)		{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected, enabled); return std::make_tuple(selected, activated); }
+	inline bool MenuItem(const char* label)																							{ return ImGui::MenuItem(label); }
+	inline bool MenuItem(const char* label, const char* shortcut)																	{ return ImGui::MenuItem(label, shortcut); }
+	inline std::tuple<bool, bool> MenuItem(const char* label, const char* shortcut, bool selected)									{ bool activated = ImGui::MenuItem(label, shortcut, &selected); return std::make_tuple(selected, activated); }
+	inline std::tuple<bool, bool> MenuItem(const char* label, const char* shortcut, bool selected, bool enabled)					{ bool activated = ImGui::MenuItem(label, shortcut, &selected, enabled); return std::make_tuple(selected, activated); }
 
 	// Tooltips
 	inline void BeginTooltip()																			{ ImGui::BeginTooltip(); }
 	inline void EndTooltip()																			{ ImGui::EndTooltip(); }
-	inline void SetTooltip(const std::string& fmt)														{ ImGui::SetTooltip(fmt.c_str()); }
+	inline void SetTooltip(const char* fmt)																{ ImGui::SetTooltip(fmt); }
 	inline void SetTooltipV()																			{ /* TODO: SetTooltipV(...) ==> UNSUPPORTED */ }
 
 	// Popups, Modals
-	inline bool BeginPopup(const std::string& str_id)													{ return ImGui::BeginPopup(str_id.c_str()); }
-	inline bool BeginPopup(const std::string& str_id, int flags)										{ return ImGui::BeginPopup(str_id.c_str(), static_cast<ImGuiWindowFlags>(flags)); }
-	inline bool BeginPopupModal(const std::string& name)												{ return ImGui::BeginPopupModal(name.c_str()); }
-	inline bool BeginPopupModal(const std::string& name, bool open)										{ return ImGui::BeginPopupModal(name.c_str(), &open); }
-	inline bool BeginPopupModal(const std::string& name, bool open, int flags)							{ return ImGui::BeginPopupModal(name.c_str(), &open, static_cast<ImGuiWindowFlags>(flags)); }
+	inline bool BeginPopup(const char* str_id)															{ return ImGui::BeginPopup(str_id); }
+	inline bool BeginPopup(const char* str_id, int flags)												{ return ImGui::BeginPopup(str_id, static_cast<ImGuiWindowFlags>(flags)); }
+	inline bool BeginPopupModal(const char* name)														{ return ImGui::BeginPopupModal(name); }
+	inline bool BeginPopupModal(const char* name, bool open)											{ return ImGui::BeginPopupModal(name, &open); }
+	inline bool BeginPopupModal(const char* name, bool open, int flags)									{ return ImGui::BeginPopupModal(name, &open, static_cast<ImGuiWindowFlags>(flags)); }
 	inline void EndPopup()																				{ ImGui::EndPopup(); }
-	inline void OpenPopup(const std::string& str_id)													{ ImGui::OpenPopup(str_id.c_str()); }
-	inline void OpenPopup(const std::string& str_id, int popup_flags)									{ ImGui::OpenPopup(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline void OpenPopup(const char* str_id)															{ ImGui::OpenPopup(str_id); }
+	inline void OpenPopup(const char* str_id, int popup_flags)											{ ImGui::OpenPopup(str_id, static_cast<ImGuiPopupFlags>(popup_flags)); }
 	inline void OpenPopupOnItemClick() { return ImGui::OpenPopupOnItemClick(); }
-	inline void OpenPopupOnItemClick(const std::string& str_id) { return ImGui::OpenPopupOnItemClick(str_id.c_str()); }
-	inline void OpenPopupOnItemClick(const std::string& str_id, int popup_flags) { return ImGui::OpenPopupOnItemClick(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline void OpenPopupOnItemClick(const char* str_id) { return ImGui::OpenPopupOnItemClick(str_id); }
+	inline void OpenPopupOnItemClick(const char* str_id, int popup_flags) { return ImGui::OpenPopupOnItemClick(str_id, static_cast<ImGuiPopupFlags>(popup_flags)); }
 	inline void CloseCurrentPopup()																		{ ImGui::CloseCurrentPopup(); }
 	inline bool BeginPopupContextItem()																	{ return ImGui::BeginPopupContextItem(); }
-	inline bool BeginPopupContextItem(const std::string& str_id)										{ return ImGui::BeginPopupContextItem(str_id.c_str()); }
-	inline bool BeginPopupContextItem(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextItem(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline bool BeginPopupContextItem(const char* str_id)												{ return ImGui::BeginPopupContextItem(str_id); }
+	inline bool BeginPopupContextItem(const char* str_id, int popup_flags)								{ return ImGui::BeginPopupContextItem(str_id, static_cast<ImGuiPopupFlags>(popup_flags)); }
 	inline bool BeginPopupContextWindow()																{ return ImGui::BeginPopupContextWindow(); }
-	inline bool BeginPopupContextWindow(const std::string& str_id)										{ return ImGui::BeginPopupContextWindow(str_id.c_str()); }
-	inline bool BeginPopupContextWindow(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextWindow(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline bool BeginPopupContextWindow(const char* str_id)												{ return ImGui::BeginPopupContextWindow(str_id); }
+	inline bool BeginPopupContextWindow(const char* str_id, int popup_flags)							{ return ImGui::BeginPopupContextWindow(str_id, static_cast<ImGuiPopupFlags>(popup_flags)); }
 	inline bool BeginPopupContextVoid()																	{ return ImGui::BeginPopupContextVoid(); }
-	inline bool BeginPopupContextVoid(const std::string& str_id)										{ return ImGui::BeginPopupContextVoid(str_id.c_str()); }
-	inline bool BeginPopupContextVoid(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextVoid(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
-	inline bool IsPopupOpen(const std::string& str_id)													{ return ImGui::IsPopupOpen(str_id.c_str()); }
-	inline bool IsPopupOpen(const std::string& str_id, int popup_flags)									{ return ImGui::IsPopupOpen(str_id.c_str(), popup_flags); }
+	inline bool BeginPopupContextVoid(const char* str_id)												{ return ImGui::BeginPopupContextVoid(str_id); }
+	inline bool BeginPopupContextVoid(const char* str_id, int popup_flags)								{ return ImGui::BeginPopupContextVoid(str_id, static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline bool IsPopupOpen(const char* str_id)															{ return ImGui::IsPopupOpen(str_id); }
+	inline bool IsPopupOpen(const char* str_id, int popup_flags)										{ return ImGui::IsPopupOpen(str_id, popup_flags); }
 
 	// Columns
 	inline void Columns()																				{ ImGui::Columns(); }
 	inline void Columns(int count)																		{ ImGui::Columns(count); }
-	inline void Columns(int count, const std::string& id)												{ ImGui::Columns(count, id.c_str()); }
-	inline void Columns(int count, const std::string& id, bool border)									{ ImGui::Columns(count, id.c_str(), border); }
+	inline void Columns(int count, const char* id)														{ ImGui::Columns(count, id); }
+	inline void Columns(int count, const char* id, bool border)											{ ImGui::Columns(count, id, border); }
 	inline void NextColumn()																			{ ImGui::NextColumn(); }
 	inline int GetColumnIndex()																			{ return ImGui::GetColumnIndex(); }
 	inline float GetColumnWidth()																		{ return ImGui::GetColumnWidth(); }
@@ -1495,26 +1668,26 @@ namespace sol_ImGui
 	inline int GetColumnsCount()																		{ return ImGui::GetColumnsCount(); }
 
 	// Tab Bars, Tabs
-	inline bool BeginTabBar(const std::string& str_id)													{ return ImGui::BeginTabBar(str_id.c_str()); }
-	inline bool BeginTabBar(const std::string& str_id, int flags)										{ return ImGui::BeginTabBar(str_id.c_str(), static_cast<ImGuiTabBarFlags>(flags)); }
+	inline bool BeginTabBar(const char* str_id)															{ return ImGui::BeginTabBar(str_id); }
+	inline bool BeginTabBar(const char* str_id, int flags)												{ return ImGui::BeginTabBar(str_id, static_cast<ImGuiTabBarFlags>(flags)); }
 	inline void EndTabBar()																				{ ImGui::EndTabBar(); }
-	inline bool BeginTabItem(const std::string& label)													{ return ImGui::BeginTabItem(label.c_str()); }
-	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open)						{ bool selected = ImGui::BeginTabItem(label.c_str(), &open); return std::make_tuple(open, selected); }
-	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open, int flags)			{ bool selected = ImGui::BeginTabItem(label.c_str(), &open, static_cast<ImGuiTabItemFlags>(flags)); return std::make_tuple(open, selected); }
+	inline bool BeginTabItem(const char* label)															{ return ImGui::BeginTabItem(label); }
+	inline std::tuple<bool, bool> BeginTabItem(const char* label, bool open)							{ bool selected = ImGui::BeginTabItem(label, &open); return std::make_tuple(open, selected); }
+	inline std::tuple<bool, bool> BeginTabItem(const char* label, bool open, int flags)					{ bool selected = ImGui::BeginTabItem(label, &open, static_cast<ImGuiTabItemFlags>(flags)); return std::make_tuple(open, selected); }
 	inline void EndTabItem()																			{ ImGui::EndTabItem(); }
-	inline void SetTabItemClosed(const std::string& tab_or_docked_window_label)							{ ImGui::SetTabItemClosed(tab_or_docked_window_label.c_str()); }
+	inline void SetTabItemClosed(const char* tab_or_docked_window_label)								{ ImGui::SetTabItemClosed(tab_or_docked_window_label); }
 
 	// Logging
 	inline void LogToTTY()																				{ ImGui::LogToTTY(); }
 	inline void LogToTTY(int auto_open_depth)															{ ImGui::LogToTTY(auto_open_depth); }
 	inline void LogToFile()																				{ ImGui::LogToFile(); }
 	inline void LogToFile(int auto_open_depth)															{ ImGui::LogToFile(auto_open_depth); }
-	inline void LogToFile(int auto_open_depth, const std::string& filename)								{ ImGui::LogToFile(auto_open_depth, filename.c_str()); }
+	inline void LogToFile(int auto_open_depth, const char* filename)									{ ImGui::LogToFile(auto_open_depth, filename); }
 	inline void LogToClipboard()																		{ ImGui::LogToClipboard(); }
 	inline void LogToClipboard(int auto_open_depth)														{ ImGui::LogToClipboard(auto_open_depth); }
 	inline void LogFinish()																				{ ImGui::LogFinish(); }
 	inline void LogButtons()																			{ ImGui::LogButtons(); }
-	inline void LogText(const std::string& fmt)															{ ImGui::LogText(fmt.c_str()); }
+	inline void LogText(const char* fmt)																{ ImGui::LogText(fmt); }
 
 	// Drag and Drop
 	// TODO: Drag and Drop ==> UNSUPPORTED
@@ -1562,10 +1735,10 @@ namespace sol_ImGui
 	inline void EndChildFrame()																			{ return ImGui::EndChildFrame(); }
 
 	// Text Utilities
-	inline std::tuple<float, float> CalcTextSize(const std::string& text)																					{ const auto vec2{ ImGui::CalcTextSize(text.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end)														{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash)					{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash, float wrap_width)	{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash, wrap_width) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const char* text)																							{ const auto vec2{ ImGui::CalcTextSize(text) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const char* text, const char* text_end)																	{ const auto vec2{ ImGui::CalcTextSize(text, text_end) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash)									{ const auto vec2{ ImGui::CalcTextSize(text, text_end, hide_text_after_double_hash) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)				{ const auto vec2{ ImGui::CalcTextSize(text, text_end, hide_text_after_double_hash, wrap_width) }; return std::make_tuple(vec2.x, vec2.y); }
 
 	// Color Utilities
 #ifdef SOL_IMGUI_USE_COLOR_U32
@@ -1627,7 +1800,7 @@ namespace sol_ImGui
 
 	// Clipboard Utilities
 	inline std::string GetClipboardText()																{ return std::string(ImGui::GetClipboardText()); }
-	inline void SetClipboardText(const std::string& text)												{ ImGui::SetClipboardText(text.c_str()); }
+	inline void SetClipboardText(const char* text)														{ ImGui::SetClipboardText(text); }
 
 	inline void InitEnums(sol::state_view& lua)
 	{
@@ -2022,20 +2195,20 @@ namespace sol_ImGui
 		ImGui.set_function("GetDisplaySize"					, GetDisplaySize);
 #pragma region Windows
 		ImGui.set_function("Begin"							, sol::overload(
-																sol::resolve<bool(const std::string&)>(Begin),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(Begin), 
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(Begin)
+																sol::resolve<bool(const char*)>(Begin),
+																sol::resolve<std::tuple<bool, bool>(const char*, bool)>(Begin), 
+																sol::resolve<std::tuple<bool, bool>(const char*, bool, int)>(Begin)
 															));
 		ImGui.set_function("End"							, End);
 #pragma endregion Windows
 
 #pragma region Child Windows
 		ImGui.set_function("BeginChild"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginChild), 
-																sol::resolve<bool(const std::string&, float)>(BeginChild), 
-																sol::resolve<bool(const std::string&, float, float)>(BeginChild),
-																sol::resolve<bool(const std::string&, float, float, bool)>(BeginChild), 
-																sol::resolve<bool(const std::string&, float, float, bool, int)>(BeginChild)
+																sol::resolve<bool(const char*)>(BeginChild), 
+																sol::resolve<bool(const char*, float)>(BeginChild), 
+																sol::resolve<bool(const char*, float, float)>(BeginChild),
+																sol::resolve<bool(const char*, float, float, bool)>(BeginChild), 
+																sol::resolve<bool(const char*, float, float, bool, int)>(BeginChild)
 															));
 		ImGui.set_function("EndChild"						, EndChild);
 #pragma endregion Child Windows
@@ -2077,24 +2250,24 @@ namespace sol_ImGui
 		ImGui.set_function("SetWindowPos"					, sol::overload(
 																sol::resolve<void(float, float)>(SetWindowPos),
 																sol::resolve<void(float, float, int)>(SetWindowPos),
-																sol::resolve<void(const std::string&, float, float)>(SetWindowPos),
-																sol::resolve<void(const std::string&, float, float, int)>(SetWindowPos)
+																sol::resolve<void(const char*, float, float)>(SetWindowPos),
+																sol::resolve<void(const char*, float, float, int)>(SetWindowPos)
 															));
 		ImGui.set_function("SetWindowSize"					, sol::overload(
 																sol::resolve<void(float, float)>(SetWindowSize),
 																sol::resolve<void(float, float, int)>(SetWindowSize),
-																sol::resolve<void(const std::string&, float, float)>(SetWindowSize),
-																sol::resolve<void(const std::string&, float, float, int)>(SetWindowSize)
+																sol::resolve<void(const char*, float, float)>(SetWindowSize),
+																sol::resolve<void(const char*, float, float, int)>(SetWindowSize)
 															));
 		ImGui.set_function("SetWindowCollapsed"				, sol::overload(
 																sol::resolve<void(bool)>(SetWindowCollapsed),
 																sol::resolve<void(bool, int)>(SetWindowCollapsed),
-																sol::resolve<void(const std::string&, bool)>(SetWindowCollapsed),
-																sol::resolve<void(const std::string&, bool, int)>(SetWindowCollapsed)
+																sol::resolve<void(const char*, bool)>(SetWindowCollapsed),
+																sol::resolve<void(const char*, bool, int)>(SetWindowCollapsed)
 															));
 		ImGui.set_function("SetWindowFocus"					, sol::overload(
 																sol::resolve<void()>(SetWindowFocus),
-																sol::resolve<void(const std::string&)>(SetWindowFocus)
+																sol::resolve<void(const char*)>(SetWindowFocus)
 															));
 		ImGui.set_function("SetWindowFontScale"				, SetWindowFontScale);
 #pragma endregion Window Utilities
@@ -2213,21 +2386,21 @@ namespace sol_ImGui
 		
 #pragma region ID stack / scopes
 		ImGui.set_function("PushID"							, sol::overload(
-																sol::resolve<void(const std::string&)>(PushID), 
-																sol::resolve<void(const std::string&, const std::string&)>(PushID), 
+																sol::resolve<void(const char*)>(PushID), 
+																sol::resolve<void(const char*, const char*)>(PushID), 
 																sol::resolve<void(int)>(PushID)
 															));
 		ImGui.set_function("PopID"							, PopID);
 		ImGui.set_function("GetID"							, sol::overload(
-																sol::resolve<int(const std::string&)>(GetID), 
-																sol::resolve<int(const std::string&, const std::string&)>(GetID)
+																sol::resolve<int(const char*)>(GetID), 
+																sol::resolve<int(const char*, const char*)>(GetID)
 															));
 #pragma endregion ID stack / scopes
 		
 #pragma region Widgets: Text
 		ImGui.set_function("TextUnformatted"				, sol::overload(
-																sol::resolve<void(const std::string&)>(TextUnformatted), 
-																sol::resolve<void(const std::string&, const std::string&)>(TextUnformatted)
+																sol::resolve<void(const char*)>(TextUnformatted), 
+																sol::resolve<void(const char*, const char*)>(TextUnformatted)
 															));
 		ImGui.set_function("Text"							, Text);
 		ImGui.set_function("TextColored"					, TextColored);
@@ -2235,12 +2408,15 @@ namespace sol_ImGui
 		ImGui.set_function("TextWrapped"					, TextWrapped);
 		ImGui.set_function("LabelText"						, LabelText);
 		ImGui.set_function("BulletText"						, BulletText);
+		ImGui.set_function("TextF"							, TextF);
+		ImGui.set_function("LabelTextF"						, LabelTextF);
+		ImGui.set_function("BulletTextF"					, BulletTextF);
 #pragma endregion Widgets: Text
 		
 #pragma region Widgets: Main
 		ImGui.set_function("Button"							, sol::overload(
-																sol::resolve<bool(const std::string&)>(Button), 
-																sol::resolve<bool(const std::string&, float, float)>(Button)
+																sol::resolve<bool(const char*)>(Button), 
+																sol::resolve<bool(const char*, float, float)>(Button)
 															));
 		ImGui.set_function("SmallButton"					, SmallButton);
 		ImGui.set_function("InvisibleButton"				, InvisibleButton);
@@ -2252,249 +2428,249 @@ namespace sol_ImGui
 															));
 		ImGui.set_function("Checkbox"						, Checkbox);
 		ImGui.set_function("RadioButton"					, sol::overload(
-																sol::resolve<bool(const std::string&, bool)>(RadioButton), 
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int)>(RadioButton)
+																sol::resolve<bool(const char*, bool)>(RadioButton), 
+																sol::resolve<std::tuple<int, bool>(const char*, int, int)>(RadioButton)
 															));
 		ImGui.set_function("ProgressBar"					, sol::overload(
 																sol::resolve<void(float)>(ProgressBar), 
 																sol::resolve<void(float, float, float)>(ProgressBar), 
-																sol::resolve<void(float, float, float, const std::string&)>(ProgressBar)
+																sol::resolve<void(float, float, float, const char*)>(ProgressBar)
 															));
 		ImGui.set_function("Bullet"							, Bullet);
 #pragma endregion Widgets: Main
 		
 #pragma region Widgets: Combo Box
 		ImGui.set_function("BeginCombo"						, sol::overload(
-																sol::resolve<bool(const std::string&, const std::string&)>(BeginCombo), 
-																sol::resolve<bool(const std::string&, const std::string&, int)>(BeginCombo)
+																sol::resolve<bool(const char*, const char*)>(BeginCombo), 
+																sol::resolve<bool(const char*, const char*, int)>(BeginCombo)
 															));
 		ImGui.set_function("EndCombo"						, EndCombo);
 		ImGui.set_function("Combo"							, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const sol::table&, int)>(Combo), 
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const sol::table&, int, int)>(Combo), 
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const std::string&)>(Combo), 
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const std::string&, int)>(Combo)
+																sol::resolve<std::tuple<int, bool>(const char*, int, const sol::table&, int)>(Combo), 
+																sol::resolve<std::tuple<int, bool>(const char*, int, const sol::table&, int, int)>(Combo), 
+																sol::resolve<std::tuple<int, bool>(const char*, int, const char*)>(Combo), 
+																sol::resolve<std::tuple<int, bool>(const char*, int, const char*, int)>(Combo)
 															));
 #pragma endregion Widgets: Combo Box
 
 #pragma region Widgets: Drags
 		ImGui.set_function("DragFloat"						, sol::overload(
-																sol::resolve<std::tuple<float, bool>(const std::string&, float)>(DragFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(DragFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(DragFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float)>(DragFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, const std::string&)>(DragFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, const std::string&, float)>(DragFloat)
+																sol::resolve<std::tuple<float, bool>(const char*, float)>(DragFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float)>(DragFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float)>(DragFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float)>(DragFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float, const char*)>(DragFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float, const char*, float)>(DragFloat)
 															));
 		ImGui.set_function("DragFloat2"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(DragFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float)>(DragFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(DragFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float)>(DragFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&)>(DragFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&, float)>(DragFloat2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(DragFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float)>(DragFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(DragFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float)>(DragFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*)>(DragFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*, float)>(DragFloat2)
 															));
 		ImGui.set_function("DragFloat3"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(DragFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float)>(DragFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(DragFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float)>(DragFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&)>(DragFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&, float)>(DragFloat3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(DragFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float)>(DragFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(DragFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float)>(DragFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*)>(DragFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*, float)>(DragFloat3)
 															));
 		ImGui.set_function("DragFloat4"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(DragFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float)>(DragFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(DragFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float)>(DragFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&)>(DragFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, float, const std::string&, float)>(DragFloat4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(DragFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float)>(DragFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(DragFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float)>(DragFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*)>(DragFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, float, const char*, float)>(DragFloat4)
 															));
 		ImGui.set_function("DragInt"						, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, int)>(DragInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, float)>(DragInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int)>(DragInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int, int)>(DragInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int, int, const std::string&)>(DragInt)
+																sol::resolve<std::tuple<int, bool>(const char*, int)>(DragInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, float)>(DragInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, float, int)>(DragInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, float, int, int)>(DragInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, float, int, int, const char*)>(DragInt)
 															));
 		ImGui.set_function("DragInt2"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(DragInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float)>(DragInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int)>(DragInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int)>(DragInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int, const std::string&)>(DragInt2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(DragInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float)>(DragInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int)>(DragInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int)>(DragInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int, const char*)>(DragInt2)
 															));											
 		ImGui.set_function("DragInt3"						, sol::overload(			
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(DragInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float)>(DragInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int)>(DragInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int)>(DragInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int, const std::string&)>(DragInt3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(DragInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float)>(DragInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int)>(DragInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int)>(DragInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int, const char*)>(DragInt3)
 															));														
 		ImGui.set_function("DragInt4"						, sol::overload(			
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(DragInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float)>(DragInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int)>(DragInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int)>(DragInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int, const std::string&)>(DragInt4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(DragInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float)>(DragInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int)>(DragInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int)>(DragInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, float, int, int, const char*)>(DragInt4)
 															));
 #pragma endregion Widgets: Drags
 
 #pragma region Widgets: Sliders
 		ImGui.set_function("SliderFloat"					, sol::overload(
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(SliderFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(SliderFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&, float)>(SliderFloat)
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float)>(SliderFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, const char*)>(SliderFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, const char*, float)>(SliderFloat)
 															));
 		ImGui.set_function("SliderFloat2"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(SliderFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&)>(SliderFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&, float)>(SliderFloat2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(SliderFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*)>(SliderFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*, float)>(SliderFloat2)
 															));
 		ImGui.set_function("SliderFloat3"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(SliderFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&)>(SliderFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&, float)>(SliderFloat3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(SliderFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*)>(SliderFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*, float)>(SliderFloat3)
 															));
 		ImGui.set_function("SliderFloat4"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float)>(SliderFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&)>(SliderFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, float, float, const std::string&, float)>(SliderFloat4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float)>(SliderFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*)>(SliderFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, float, float, const char*, float)>(SliderFloat4)
 															));
 		ImGui.set_function("SliderAngle"					, sol::overload(
-																sol::resolve<std::tuple<float, bool>(const std::string&, float)>(SliderAngle),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(SliderAngle),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(SliderAngle),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(SliderAngle)
+																sol::resolve<std::tuple<float, bool>(const char*, float)>(SliderAngle),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float)>(SliderAngle),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float)>(SliderAngle),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, const char*)>(SliderAngle)
 															));
 		ImGui.set_function("SliderInt"						, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int)>(SliderInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int, const std::string&)>(SliderInt)
+																sol::resolve<std::tuple<int, bool>(const char*, int, int, int)>(SliderInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, int, int, const char*)>(SliderInt)
 															));
 		ImGui.set_function("SliderInt2"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int)>(SliderInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int, const std::string&)>(SliderInt2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int)>(SliderInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int, const char*)>(SliderInt2)
 															));
 		ImGui.set_function("SliderInt3"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int)>(SliderInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int, const std::string&)>(SliderInt3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int)>(SliderInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int, const char*)>(SliderInt3)
 															));
 		ImGui.set_function("SliderInt4"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int)>(SliderInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int, int, const std::string&)>(SliderInt4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int)>(SliderInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int, int, const char*)>(SliderInt4)
 															));
 		ImGui.set_function("VSliderFloat"					, sol::overload(
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, float)>(VSliderFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, float, const std::string&)>(VSliderFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, float, const std::string&, int)>(VSliderFloat)
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float, float)>(VSliderFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float, float, const char*)>(VSliderFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, float, float, const char*, int)>(VSliderFloat)
 															));
 		ImGui.set_function("VSliderInt"						, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, float, float, int, int, int)>(VSliderInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, float, float, int, int, int, const std::string&)>(VSliderInt)
+																sol::resolve<std::tuple<int, bool>(const char*, float, float, int, int, int)>(VSliderInt),
+																sol::resolve<std::tuple<int, bool>(const char*, float, float, int, int, int, const char*)>(VSliderInt)
 															));
 #pragma endregion Widgets: Sliders
 
 #pragma region Widgets: Inputs using Keyboard
 		ImGui.set_function("InputText"						, sol::overload(
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, unsigned int)>(InputText),
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, unsigned int, int)>(InputText)
+																sol::resolve<std::tuple<std::string, bool>(const char*, std::string, unsigned int)>(InputText),
+																sol::resolve<std::tuple<std::string, bool>(const char*, std::string, unsigned int, int)>(InputText)
 															));
 		ImGui.set_function("InputTextMultiline"				, sol::overload(
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, unsigned int)>(InputTextMultiline),
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, unsigned int, float, float)>(InputTextMultiline),
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, unsigned int, float, float, int)>(InputTextMultiline)
+																sol::resolve<std::tuple<std::string, bool>(const char*, std::string, unsigned int)>(InputTextMultiline),
+																sol::resolve<std::tuple<std::string, bool>(const char*, std::string, unsigned int, float, float)>(InputTextMultiline),
+																sol::resolve<std::tuple<std::string, bool>(const char*, std::string, unsigned int, float, float, int)>(InputTextMultiline)
 															));
 		ImGui.set_function("InputTextWithHint"				, sol::overload(
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, const std::string&, std::string, unsigned int)>(InputTextWithHint),
-																sol::resolve<std::tuple<std::string, bool>(const std::string&, const std::string&, std::string, unsigned int, int)>(InputTextWithHint)
+																sol::resolve<std::tuple<std::string, bool>(const char*, const char*, std::string, unsigned int)>(InputTextWithHint),
+																sol::resolve<std::tuple<std::string, bool>(const char*, const char*, std::string, unsigned int, int)>(InputTextWithHint)
 															));
 		ImGui.set_function("InputFloat"						, sol::overload(
-																sol::resolve<std::tuple<float, bool>(const std::string&, float)>(InputFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(InputFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(InputFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(InputFloat),
-																sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&, int)>(InputFloat)
+																sol::resolve<std::tuple<float, bool>(const char*, float)>(InputFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float)>(InputFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float)>(InputFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, const char*)>(InputFloat),
+																sol::resolve<std::tuple<float, bool>(const char*, float, float, float, const char*, int)>(InputFloat)
 															));
 		ImGui.set_function("InputFloat2"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(InputFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&)>(InputFloat2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&, int)>(InputFloat2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(InputFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*)>(InputFloat2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*, int)>(InputFloat2)
 															));
 		ImGui.set_function("InputFloat3"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(InputFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&)>(InputFloat3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&, int)>(InputFloat3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(InputFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*)>(InputFloat3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*, int)>(InputFloat3)
 															));
 		ImGui.set_function("InputFloat4"					, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(InputFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&)>(InputFloat4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, const std::string&, int)>(InputFloat4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(InputFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*)>(InputFloat4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, const char*, int)>(InputFloat4)
 															));
 		ImGui.set_function("InputInt"						, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, int)>(InputInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int)>(InputInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int)>(InputInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int)>(InputInt),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int, int)>(InputInt)
+																sol::resolve<std::tuple<int, bool>(const char*, int)>(InputInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, int)>(InputInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, int, int)>(InputInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, int, int)>(InputInt),
+																sol::resolve<std::tuple<int, bool>(const char*, int, int, int, int)>(InputInt)
 															));
 		ImGui.set_function("InputInt2"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(InputInt2),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int)>(InputInt2)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(InputInt2),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int)>(InputInt2)
 															));
 		ImGui.set_function("InputInt3"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(InputInt3),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int)>(InputInt3)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(InputInt3),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int)>(InputInt3)
 															));
 		ImGui.set_function("InputInt4"						, sol::overload(
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&)>(InputInt4),
-																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, int)>(InputInt4)
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&)>(InputInt4),
+																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const char*, const sol::table&, int)>(InputInt4)
 															));
 		ImGui.set_function("InputDouble"					, sol::overload(
-																sol::resolve<std::tuple<double, bool>(const std::string&, double)>(InputDouble),
-																sol::resolve<std::tuple<double, bool>(const std::string&, double, double)>(InputDouble),
-																sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double)>(InputDouble),
-																sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&)>(InputDouble),
-																sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&, int)>(InputDouble)
+																sol::resolve<std::tuple<double, bool>(const char*, double)>(InputDouble),
+																sol::resolve<std::tuple<double, bool>(const char*, double, double)>(InputDouble),
+																sol::resolve<std::tuple<double, bool>(const char*, double, double, double)>(InputDouble),
+																sol::resolve<std::tuple<double, bool>(const char*, double, double, double, const char*)>(InputDouble),
+																sol::resolve<std::tuple<double, bool>(const char*, double, double, double, const char*, int)>(InputDouble)
 															));
 #pragma endregion Widgets: Inputs using Keyboard
 
 #pragma region Widgets: Color Editor / Picker
 		ImGui.set_function("ColorEdit3"						, sol::overload(
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(ColorEdit3),
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, int)>(ColorEdit3)
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(ColorEdit3),
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, int)>(ColorEdit3)
 															));
 		ImGui.set_function("ColorEdit4"						, sol::overload(
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(ColorEdit4),
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, int)>(ColorEdit4)
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(ColorEdit4),
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, int)>(ColorEdit4)
 															));
 		ImGui.set_function("ColorPicker3"					, sol::overload(
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(ColorPicker3),
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, int)>(ColorPicker3)
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(ColorPicker3),
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, int)>(ColorPicker3)
 															));
 		ImGui.set_function("ColorPicker4"					, sol::overload(
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&)>(ColorPicker4),
-																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const std::string&, const sol::table&, int)>(ColorPicker4)
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&)>(ColorPicker4),
+																sol::resolve<std::tuple <sol::as_table_t<std::vector<float>>, bool>(const char*, const sol::table&, int)>(ColorPicker4)
 															));
 #pragma endregion Widgets: Color Editor / Picker
 
 #pragma region Widgets: Trees
 		ImGui.set_function("TreeNode"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(TreeNode),
-																sol::resolve<bool(const std::string&, const std::string&)>(TreeNode)
+																sol::resolve<bool(const char*)>(TreeNode),
+																sol::resolve<bool(const char*, const char*)>(TreeNode)
 															));
 		ImGui.set_function("TreeNodeEx"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(TreeNodeEx),
-																sol::resolve<bool(const std::string&, int)>(TreeNodeEx),
-																sol::resolve<bool(const std::string&, int, const std::string&)>(TreeNodeEx)
+																sol::resolve<bool(const char*)>(TreeNodeEx),
+																sol::resolve<bool(const char*, int)>(TreeNodeEx),
+																sol::resolve<bool(const char*, int, const char*)>(TreeNodeEx)
 															));
 		ImGui.set_function("TreePush"						, TreePush);
 		ImGui.set_function("TreePop"						, TreePop);
 		ImGui.set_function("GetTreeNodeToLabelSpacing"		, GetTreeNodeToLabelSpacing);
 		ImGui.set_function("CollapsingHeader"				, sol::overload(
-																sol::resolve<bool(const std::string&)>(CollapsingHeader),
-																sol::resolve<bool(const std::string&, int)>(CollapsingHeader),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(CollapsingHeader),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(CollapsingHeader)
+																sol::resolve<bool(const char*)>(CollapsingHeader),
+																sol::resolve<bool(const char*, int)>(CollapsingHeader),
+																sol::resolve<std::tuple<bool, bool>(const char*, bool)>(CollapsingHeader),
+																sol::resolve<std::tuple<bool, bool>(const char*, bool, int)>(CollapsingHeader)
 															));
 		ImGui.set_function("SetNextItemOpen"				, sol::overload(
 																sol::resolve<void(bool)>(SetNextItemOpen),
@@ -2504,17 +2680,17 @@ namespace sol_ImGui
 
 #pragma region Widgets: Selectables
 		ImGui.set_function("Selectable"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(Selectable),
-																sol::resolve<bool(const std::string&, bool)>(Selectable),
-																sol::resolve<bool(const std::string&, bool, int)>(Selectable),
-																sol::resolve<bool(const std::string&, bool, int, float, float)>(Selectable)
+																sol::resolve<bool(const char*)>(Selectable),
+																sol::resolve<bool(const char*, bool)>(Selectable),
+																sol::resolve<bool(const char*, bool, int)>(Selectable),
+																sol::resolve<bool(const char*, bool, int, float, float)>(Selectable)
 															));
 #pragma endregion Widgets: Selectables
 
 #pragma region Widgets: List Boxes
 		ImGui.set_function("ListBox"						, sol::overload(
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const sol::table&, int)>(ListBox),
-																sol::resolve<std::tuple<int, bool>(const std::string&, int, const sol::table&, int, int)>(ListBox)
+																sol::resolve<std::tuple<int, bool>(const char*, int, const sol::table&, int)>(ListBox),
+																sol::resolve<std::tuple<int, bool>(const char*, int, const sol::table&, int, int)>(ListBox)
 															));
 		ImGui.set_function("ListBoxHeader"					, BeginListBox);
 		ImGui.set_function("BeginListBox"					, BeginListBox);
@@ -2524,11 +2700,11 @@ namespace sol_ImGui
 
 #pragma region Widgets: Value() Helpers
 		ImGui.set_function("Value"							, sol::overload(
-																sol::resolve<void(const std::string&, bool)>(Value),
-																sol::resolve<void(const std::string&, int)>(Value),
-																sol::resolve<void(const std::string&, unsigned int)>(Value),
-																sol::resolve<void(const std::string&, float)>(Value),
-																sol::resolve<void(const std::string&, float, const std::string&)>(Value)
+																sol::resolve<void(const char*, bool)>(Value),
+																sol::resolve<void(const char*, int)>(Value),
+																sol::resolve<void(const char*, unsigned int)>(Value),
+																sol::resolve<void(const char*, float)>(Value),
+																sol::resolve<void(const char*, float, const char*)>(Value)
 															));
 #pragma endregion Widgets: Value() Helpers
 
@@ -2538,15 +2714,15 @@ namespace sol_ImGui
 		ImGui.set_function("BeginMainMenuBar"				, BeginMainMenuBar);
 		ImGui.set_function("EndMainMenuBar"					, EndMainMenuBar);
 		ImGui.set_function("BeginMenu"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginMenu),
-																sol::resolve<bool(const std::string&, bool)>(BeginMenu)
+																sol::resolve<bool(const char*)>(BeginMenu),
+																sol::resolve<bool(const char*, bool)>(BeginMenu)
 															));
 		ImGui.set_function("EndMenu"						, EndMenu);
 		ImGui.set_function("MenuItem"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(MenuItem),
-																sol::resolve<bool(const std::string&, const std::string&)>(MenuItem),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, const std::string&, bool)>(MenuItem),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, const std::string&, bool, bool)>(MenuItem)
+																sol::resolve<bool(const char*)>(MenuItem),
+																sol::resolve<bool(const char*, const char*)>(MenuItem),
+																sol::resolve<std::tuple<bool, bool>(const char*, const char*, bool)>(MenuItem),
+																sol::resolve<std::tuple<bool, bool>(const char*, const char*, bool, bool)>(MenuItem)
 															));
 #pragma endregion Widgets: Menu
 
@@ -2558,43 +2734,43 @@ namespace sol_ImGui
 
 #pragma region Popups, Modals
 		ImGui.set_function("BeginPopup"						, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginPopup),
-																sol::resolve<bool(const std::string&, int)>(BeginPopup)
+																sol::resolve<bool(const char*)>(BeginPopup),
+																sol::resolve<bool(const char*, int)>(BeginPopup)
 															));
 		ImGui.set_function("BeginPopupModal"				, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginPopupModal),
-																sol::resolve<bool(const std::string&, bool)>(BeginPopupModal),
-																sol::resolve<bool(const std::string&, bool, int)>(BeginPopupModal)
+																sol::resolve<bool(const char*)>(BeginPopupModal),
+																sol::resolve<bool(const char*, bool)>(BeginPopupModal),
+																sol::resolve<bool(const char*, bool, int)>(BeginPopupModal)
 															));
 		ImGui.set_function("EndPopup"						, EndPopup);
 		ImGui.set_function("OpenPopup"						, sol::overload(
-																sol::resolve<void(const std::string&)>(OpenPopup),
-																sol::resolve<void(const std::string&, int)>(OpenPopup)
+																sol::resolve<void(const char*)>(OpenPopup),
+																sol::resolve<void(const char*, int)>(OpenPopup)
 															));
 		ImGui.set_function("OpenPopupOnItemClick",			sol::overload(
 																sol::resolve<void()>(OpenPopupOnItemClick),
-																sol::resolve<void(const std::string&)>(OpenPopupOnItemClick),
-																sol::resolve<void(const std::string&, int)>(OpenPopupOnItemClick)
+																sol::resolve<void(const char*)>(OpenPopupOnItemClick),
+																sol::resolve<void(const char*, int)>(OpenPopupOnItemClick)
 															));
 		ImGui.set_function("CloseCurrentPopup"				, CloseCurrentPopup);
 		ImGui.set_function("BeginPopupContextItem"			, sol::overload(
 																sol::resolve<bool()>(BeginPopupContextItem),
-																sol::resolve<bool(const std::string&)>(BeginPopupContextItem),
-																sol::resolve<bool(const std::string&, int)>(BeginPopupContextItem)
+																sol::resolve<bool(const char*)>(BeginPopupContextItem),
+																sol::resolve<bool(const char*, int)>(BeginPopupContextItem)
 															));
 		ImGui.set_function("BeginPopupContextWindow"		, sol::overload(
 																sol::resolve<bool()>(BeginPopupContextWindow),
-																sol::resolve<bool(const std::string&)>(BeginPopupContextWindow),
-																sol::resolve<bool(const std::string&, int)>(BeginPopupContextWindow)
+																sol::resolve<bool(const char*)>(BeginPopupContextWindow),
+																sol::resolve<bool(const char*, int)>(BeginPopupContextWindow)
 															));
 		ImGui.set_function("BeginPopupContextVoid"			, sol::overload(
 																sol::resolve<bool()>(BeginPopupContextVoid),
-																sol::resolve<bool(const std::string&)>(BeginPopupContextVoid),
-																sol::resolve<bool(const std::string&, int)>(BeginPopupContextVoid)
+																sol::resolve<bool(const char*)>(BeginPopupContextVoid),
+																sol::resolve<bool(const char*, int)>(BeginPopupContextVoid)
 															));
 		ImGui.set_function("IsPopupOpen"					, sol::overload(
-																sol::resolve<bool(const std::string&)>(IsPopupOpen),
-																sol::resolve<bool(const std::string&, int)>(IsPopupOpen)
+																sol::resolve<bool(const char*)>(IsPopupOpen),
+																sol::resolve<bool(const char*, int)>(IsPopupOpen)
 															));
 #pragma endregion Popups, Modals
 
@@ -2602,8 +2778,8 @@ namespace sol_ImGui
 		ImGui.set_function("Columns"						, sol::overload(
 																sol::resolve<void()>(Columns),
 																sol::resolve<void(int)>(Columns),
-																sol::resolve<void(int, const std::string&)>(Columns),
-																sol::resolve<void(int, const std::string&, bool)>(Columns)
+																sol::resolve<void(int, const char*)>(Columns),
+																sol::resolve<void(int, const char*, bool)>(Columns)
 															));
 		ImGui.set_function("NextColumn"						, NextColumn);
 		ImGui.set_function("GetColumnIndex"					, GetColumnIndex);
@@ -2622,14 +2798,14 @@ namespace sol_ImGui
 
 #pragma region Tab Bars, Tabs
 		ImGui.set_function("BeginTabBar"					, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginTabBar),
-																sol::resolve<bool(const std::string&, int)>(BeginTabBar)
+																sol::resolve<bool(const char*)>(BeginTabBar),
+																sol::resolve<bool(const char*, int)>(BeginTabBar)
 															));
 		ImGui.set_function("EndTabBar"						, EndTabBar);
 		ImGui.set_function("BeginTabItem"					, sol::overload(
-																sol::resolve<bool(const std::string&)>(BeginTabItem),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(BeginTabItem),
-																sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(BeginTabItem)
+																sol::resolve<bool(const char*)>(BeginTabItem),
+																sol::resolve<std::tuple<bool, bool>(const char*, bool)>(BeginTabItem),
+																sol::resolve<std::tuple<bool, bool>(const char*, bool, int)>(BeginTabItem)
 															));
 		ImGui.set_function("EndTabItem"						, EndTabItem);
 		ImGui.set_function("SetTabItemClosed"				, SetTabItemClosed);
@@ -2642,7 +2818,7 @@ namespace sol_ImGui
 															));
 		ImGui.set_function("LogToFile"						, sol::overload(
 																sol::resolve<void(int)>(LogToFile),
-																sol::resolve<void(int, const std::string&)>(LogToFile)
+																sol::resolve<void(int, const char*)>(LogToFile)
 															));
 		ImGui.set_function("LogToClipboard"					, sol::overload(
 																sol::resolve<void()>(LogToClipboard),
@@ -2709,10 +2885,10 @@ namespace sol_ImGui
 
 #pragma region Text Utilities
 		ImGui.set_function("CalcTextSize"					, sol::overload(
-																sol::resolve<std::tuple<float, float>(const std::string&)>(CalcTextSize),
-																sol::resolve<std::tuple<float, float>(const std::string&, const std::string&)>(CalcTextSize),
-																sol::resolve<std::tuple<float, float>(const std::string&, const std::string&, bool)>(CalcTextSize),
-																sol::resolve<std::tuple<float, float>(const std::string&, const std::string&, bool, float)>(CalcTextSize)
+																sol::resolve<std::tuple<float, float>(const char*)>(CalcTextSize),
+																sol::resolve<std::tuple<float, float>(const char*, const char*)>(CalcTextSize),
+																sol::resolve<std::tuple<float, float>(const char*, const char*, bool)>(CalcTextSize),
+																sol::resolve<std::tuple<float, float>(const char*, const char*, bool, float)>(CalcTextSize)
 															));
 #pragma endregion Text Utilities
 
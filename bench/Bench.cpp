@@ -0,0 +1,259 @@
+// Headless benchmark of the Lua binding layer: a real ImGui context with a fixed display size and
+// no renderer, fresh Lua states bound through sol_ImGui::Init, and scripted on_imgui workloads.
+// Reports per workload the time per on_imgui call, allocations and bytes per frame, the time the
+// collector needs to pay for them, and the slowest bindings as LuaProfiler sees them.
+//
+//	LuaEngineUIBench [frames] [script.lua ...]	-- each script defines a global on_imgui
+#include <imgui.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sol_ImGui.h"
+#include "LuaProfiler.h"
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	struct Workload {
+		std::string name;
+		std::string source;
+	};
+
+	const Workload kWorkloads[] = {
+		{ "text_concat", R"(
+			local hp, frame = 100, 0
+			function on_imgui()
+				frame = frame + 1
+				ImGui.Begin("Stats")
+				for i = 1, 200 do
+					ImGui.Text("row " .. i .. ": " .. (hp - i) .. " / " .. frame)
+				end
+				ImGui.End()
+			end
+		)" },
+		{ "text_format", R"(
+			local hp, frame = 100, 0
+			function on_imgui()
+				frame = frame + 1
+				ImGui.Begin("Stats")
+				for i = 1, 200 do
+					ImGui.TextF("row %d: %d / %d", i, hp - i, frame)
+				end
+				ImGui.End()
+			end
+		)" },
+		{ "widgets", R"(
+			local checks, values = {}, {}
+			for i = 1, 50 do checks[i] = false; values[i] = i / 50 end
+			function on_imgui()
+				ImGui.Begin("Widgets")
+				for i = 1, 50 do
+					ImGui.PushID(i)
+					checks[i] = ImGui.Checkbox("enabled", checks[i])
+					ImGui.SameLine()
+					values[i] = ImGui.SliderFloat("value", values[i], 0, 1)
+					if ImGui.Button("reset") then values[i] = 0 end
+					ImGui.PopID()
+				end
+				ImGui.End()
+			end
+		)" },
+		{ "columns", R"(
+			local rows = {}
+			for i = 1, 100 do rows[i] = { name = "item" .. i, count = i, weight = i * 0.25 } end
+			function on_imgui()
+				ImGui.Begin("Inventory")
+				ImGui.Columns(3, "inventory", false)
+				for i, row in ipairs(rows) do
+					ImGui.Text(row.name)
+					ImGui.NextColumn()
+					ImGui.TextF("%d", row.count)
+					ImGui.NextColumn()
+					ImGui.TextF("%.2f kg", row.weight)
+					ImGui.NextColumn()
+				end
+				ImGui.Columns(1)
+				ImGui.End()
+			end
+		)" },
+	};
+
+	// Counts what the state asks for; the profiler's own wrapper is chained over this one
+	struct Counter {
+		uint64_t allocs = 0;
+		uint64_t bytes = 0;
+	};
+
+	void* CountingAlloc(void* ud, void* ptr, size_t osize, size_t nsize) {
+		Counter* counter = static_cast<Counter*>(ud);
+		if (nsize == 0) {
+			free(ptr);
+			return nullptr;
+		}
+		if (!ptr || nsize > osize) {
+			counter->allocs++;
+			counter->bytes += ptr ? nsize - osize : nsize;
+		}
+		return realloc(ptr, nsize);
+	}
+
+	struct Result {
+		double nsPerCall = 0;
+		double allocsPerFrame = 0;
+		double bytesPerFrame = 0;
+		double gcNsPerFrame = 0;
+	};
+
+	void NewFrame() {
+		ImGuiIO& io = ImGui::GetIO();
+		io.DeltaTime = 1.0f / 60.0f;
+		ImGui::NewFrame();
+	}
+
+	bool Load(sol::state& lua, const Workload& workload) {
+		lua.open_libraries();
+		sol::state_view view(lua);
+		sol_ImGui::Init(view);
+		LuaProfiler::Init(view);
+		auto loaded = lua.safe_script(workload.source, sol::script_pass_on_error, workload.name);
+		if (!loaded.valid() || lua["on_imgui"].get_type() != sol::type::function) {
+			std::fprintf(stderr, "%s: %s\n", workload.name.c_str(), loaded.valid() ? "no on_imgui" : loaded.get<sol::error>().what());
+			return false;
+		}
+		return true;
+	}
+
+	// The collector is stopped while on_imgui runs and paid off after each frame, so its cost shows
+	// up on its own. GcPacer only raises the pause, which within one frame comes to the same.
+	bool Measure(const Workload& workload, int frames, Result& result) {
+		Counter counter;
+		sol::state lua(sol::default_at_panic, CountingAlloc, &counter);
+		if (!Load(lua, workload))
+			return false;
+		lua_State* L = lua.lua_state();
+		sol::protected_function on_imgui = lua["on_imgui"];
+		lua_gc(L, LUA_GCCOLLECT);
+		lua_gc(L, LUA_GCSTOP);
+
+		// A few frames first so windows and scratch buffers exist
+		for (int i = 0; i < 10; i++) {
+			NewFrame();
+			on_imgui();
+			ImGui::Render();
+		}
+
+		Clock::duration call{}, gc{};
+		const Counter start = counter;
+		for (int i = 0; i < frames; i++) {
+			NewFrame();
+			const Counter before = counter;
+			const auto t0 = Clock::now();
+			auto ran = on_imgui();
+			const auto t1 = Clock::now();
+			if (!ran.valid()) {
+				std::fprintf(stderr, "%s: %s\n", workload.name.c_str(), ran.get<sol::error>().what());
+				return false;
+			}
+			ImGui::Render();
+			const int kb = static_cast<int>((counter.bytes - before.bytes) / 1024);
+			const auto t2 = Clock::now();
+			lua_gc(L, LUA_GCSTEP, kb > 0 ? kb : 1);
+			gc += Clock::now() - t2;
+			call += t1 - t0;
+		}
+		lua_gc(L, LUA_GCRESTART);
+
+		result.nsPerCall = std::chrono::duration<double, std::nano>(call).count() / frames;
+		result.gcNsPerFrame = std::chrono::duration<double, std::nano>(gc).count() / frames;
+		result.allocsPerFrame = static_cast<double>(counter.allocs - start.allocs) / frames;
+		result.bytesPerFrame = static_cast<double>(counter.bytes - start.bytes) / frames;
+		return true;
+	}
+
+	// Second pass with the binding hook on, which slows the script down, to see where time goes
+	void Profile(const Workload& workload, int frames) {
+		sol::state lua;
+		if (!Load(lua, workload))
+			return;
+		lua_State* L = lua.lua_state();
+		LuaProfiler::Sync({ L }, {});
+		lua["ImGui"]["ResetBindingStats"]();
+		lua["ImGui"]["ProfileBindings"](true);
+		sol::protected_function on_imgui = lua["on_imgui"];
+		for (int i = 0; i < frames; i++) {
+			NewFrame();
+			LuaProfiler::BeginFrame();
+			on_imgui();
+			LuaProfiler::EndFrame();
+			ImGui::Render();
+		}
+		sol::table stats = lua["ImGui"]["GetBindingStats"]();
+		for (size_t i = 1; i <= std::min<size_t>(stats.size(), 5); i++) {
+			sol::table stat = stats[i];
+			std::printf("    %-24s %10llu calls %10.1f ns/call\n", stat.get<std::string>("name").c_str(),
+				stat.get<unsigned long long>("calls"), stat.get<double>("ns_per_call"));
+		}
+		lua["ImGui"]["ProfileBindings"](false);
+		LuaProfiler::Sync({}, { L });
+	}
+
+	bool ReadFile(const char* path, std::string& out) {
+		std::ifstream in(path, std::ios::binary);
+		if (!in)
+			return false;
+		std::ostringstream text;
+		text << in.rdbuf();
+		out = text.str();
+		return true;
+	}
+
+}
+
+int main(int argc, char** argv) {
+	int frames = 600;
+	std::vector<Workload> workloads;
+	for (int i = 1; i < argc; i++) {
+		Workload workload{ argv[i], {} };
+		if (i == 1 && std::atoi(argv[i]) > 0)
+			frames = std::atoi(argv[i]);
+		else if (ReadFile(argv[i], workload.source))
+			workloads.push_back(std::move(workload));
+		else {
+			std::fprintf(stderr, "can't read %s\n", argv[i]);
+			return 1;
+		}
+	}
+	if (workloads.empty())
+		workloads.assign(std::begin(kWorkloads), std::end(kWorkloads));
+
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(1920, 1080);
+	io.IniFilename = nullptr;
+	unsigned char* pixels;
+	int width, height;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+	std::printf("%-16s %12s %12s %12s %12s\n", "workload", "ns/call", "allocs/frame", "bytes/frame", "gc ns/frame");
+	int failed = 0;
+	for (const Workload& workload : workloads) {
+		Result result;
+		if (!Measure(workload, frames, result)) {
+			failed++;
+			continue;
+		}
+		std::printf("%-16s %12.0f %12.1f %12.0f %12.0f\n", workload.name.c_str(), result.nsPerCall,
+			result.allocsPerFrame, result.bytesPerFrame, result.gcNsPerFrame);
+		Profile(workload, frames / 10 > 0 ? frames / 10 : 1);
+	}
+
+	ImGui::DestroyContext();
+	return failed;
+}
@@ -0,0 +1,69 @@
+// Times mip chain generation with each 2x2 filter kernel on a large RGBA8 image, and checks that
+// the kernels agree. Needs neither Lua nor ImGui.
+//
+//	MipmapsBench [size] [runs]	-- a size x size image, default 4096, best of 5 runs
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Mipmaps.h"
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	TextureLoader::Image Noise(int size) {
+		TextureLoader::Image image;
+		image.width = size;
+		image.height = size;
+		image.mips = 1;
+		image.pixels.resize(static_cast<size_t>(size) * size * 4);
+		uint32_t state = 0x9e3779b9u;
+		for (unsigned char& c : image.pixels) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			c = static_cast<unsigned char>(state);
+		}
+		return image;
+	}
+
+	// Best time of `runs`, in ms; the chain of the last run is left in `out`
+	double Time(const TextureLoader::Image& source, Mipmaps::Kernel kernel, int runs, TextureLoader::Image& out) {
+		double best = 0;
+		for (int i = 0; i < runs; i++) {
+			out = source;
+			const auto start = Clock::now();
+			Mipmaps::Generate(out, kernel);
+			const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			best = i == 0 ? ms : std::min(best, ms);
+		}
+		return best;
+	}
+
+}
+
+int main(int argc, char** argv) {
+	const int size = argc > 1 ? std::max(std::atoi(argv[1]), 2) : 4096;
+	const int runs = argc > 2 ? std::max(std::atoi(argv[2]), 1) : 5;
+	const TextureLoader::Image source = Noise(size);
+	const double mpixels = static_cast<double>(size) * size / 1e6;
+
+	TextureLoader::Image scalar;
+	const double scalarMs = Time(source, Mipmaps::Kernel::Scalar, runs, scalar);
+	std::printf("%-8s %10s %12s\n", "kernel", "ms", "Mpixel/s");
+	std::printf("%-8s %10.2f %12.1f\n", "scalar", scalarMs, mpixels / scalarMs * 1e3);
+	if (!Mipmaps::HasSse2())
+		return 0;
+
+	TextureLoader::Image sse2;
+	const double sse2Ms = Time(source, Mipmaps::Kernel::Sse2, runs, sse2);
+	int worst = 0;
+	for (size_t i = 0; i < scalar.pixels.size(); i++)
+		worst = std::max(worst, std::abs(scalar.pixels[i] - sse2.pixels[i]));
+	std::printf("%-8s %10.2f %12.1f\n", "sse2", sse2Ms, mpixels / sse2Ms * 1e3);
+	std::printf("speedup %.2fx, largest difference %d\n", scalarMs / sse2Ms, worst);
+	return worst <= 1 ? 0 : 1;
+}
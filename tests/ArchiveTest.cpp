@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Archive.h"
+
+namespace {
+
+	namespace fs = std::filesystem;
+
+	struct Entry {
+		std::string name;
+		std::string data;
+		uint16_t method = 0;
+		uint16_t flags = 0;
+	};
+
+	void Put16(std::vector<unsigned char>& out, uint32_t v) {
+		out.push_back(static_cast<unsigned char>(v));
+		out.push_back(static_cast<unsigned char>(v >> 8));
+	}
+
+	void Put32(std::vector<unsigned char>& out, uint32_t v) {
+		Put16(out, v & 0xffff);
+		Put16(out, v >> 16);
+	}
+
+	void PutString(std::vector<unsigned char>& out, const std::string& s) {
+		out.insert(out.end(), s.begin(), s.end());
+	}
+
+	// A zip as an archiver writes it with "store": local headers and data, the central directory,
+	// then the end record and a comment. CRCs are left at zero; the reader doesn't check them.
+	std::vector<unsigned char> Build(const std::vector<Entry>& entries, const std::string& comment) {
+		std::vector<unsigned char> out;
+		std::vector<uint32_t> locals;
+		for (const Entry& entry : entries) {
+			locals.push_back(static_cast<uint32_t>(out.size()));
+			Put32(out, 0x04034b50);
+			Put16(out, 10);
+			Put16(out, entry.flags);
+			Put16(out, entry.method);
+			Put32(out, 0);
+			Put32(out, 0);
+			Put32(out, static_cast<uint32_t>(entry.data.size()));
+			Put32(out, static_cast<uint32_t>(entry.data.size()));
+			Put16(out, static_cast<uint32_t>(entry.name.size()));
+			// An extra field, which the data comes after
+			Put16(out, 4);
+			PutString(out, entry.name);
+			Put32(out, 0xcafe0000);
+			PutString(out, entry.data);
+		}
+		const uint32_t directory = static_cast<uint32_t>(out.size());
+		for (size_t i = 0; i < entries.size(); i++) {
+			const Entry& entry = entries[i];
+			Put32(out, 0x02014b50);
+			Put16(out, 20);
+			Put16(out, 10);
+			Put16(out, entry.flags);
+			Put16(out, entry.method);
+			Put32(out, 0);
+			Put32(out, 0);
+			Put32(out, static_cast<uint32_t>(entry.data.size()));
+			Put32(out, static_cast<uint32_t>(entry.data.size()));
+			Put16(out, static_cast<uint32_t>(entry.name.size()));
+			Put16(out, 0);
+			Put16(out, 0);
+			Put16(out, 0);
+			Put16(out, 0);
+			Put32(out, 0);
+			Put32(out, locals[i]);
+			PutString(out, entry.name);
+		}
+		const uint32_t directorySize = static_cast<uint32_t>(out.size()) - directory;
+		Put32(out, 0x06054b50);
+		Put16(out, 0);
+		Put16(out, 0);
+		Put16(out, static_cast<uint32_t>(entries.size()));
+		Put16(out, static_cast<uint32_t>(entries.size()));
+		Put32(out, directorySize);
+		Put32(out, directory);
+		Put16(out, static_cast<uint32_t>(comment.size()));
+		PutString(out, comment);
+		return out;
+	}
+
+	class ArchiveTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			dir = fs::temp_directory_path() / (std::string("LuaEngineUITests-") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+			fs::create_directories(dir / "ui");
+		}
+
+		void TearDown() override {
+			std::error_code ec;
+			fs::remove_all(dir, ec);
+		}
+
+		std::string Write(const std::string& name, const std::vector<unsigned char>& bytes) {
+			const fs::path path = dir / name;
+			std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			return path.string();
+		}
+
+		fs::path dir;
+	};
+
+	std::string Member(const Archive::Zip& zip, const std::string& name) {
+		const unsigned char* data = nullptr;
+		size_t size = 0;
+		if (!zip.Find(name, data, size))
+			return "<missing>";
+		return std::string(reinterpret_cast<const char*>(data), size);
+	}
+
+}
+
+TEST_F(ArchiveTest, IndexesStoredMembers) {
+	const std::string path = Write("ui/icons.zip", Build({
+		{ "Icons/", "" },
+		{ "Icons/Sword.PNG", "sword" },
+		{ "shield.png", "shield!" },
+		{ "deflated.png", "xx", 8 },
+		{ "encrypted.png", "yy", 0, 1 },
+	}, "made by hand"));
+
+	Archive::Zip zip;
+	ASSERT_TRUE(zip.Open(path));
+	EXPECT_EQ(zip.Members(), 2u);
+	EXPECT_EQ(Member(zip, "Icons/Sword.PNG"), "sword");
+	// Lookups ignore case and take either separator
+	EXPECT_EQ(Member(zip, "icons/sword.png"), "sword");
+	EXPECT_EQ(Member(zip, "ICONS\\SWORD.png"), "sword");
+	EXPECT_EQ(Member(zip, "shield.png"), "shield!");
+	EXPECT_EQ(Member(zip, "icons"), "<missing>");
+	EXPECT_EQ(Member(zip, "deflated.png"), "<missing>");
+	EXPECT_EQ(Member(zip, "encrypted.png"), "<missing>");
+}
+
+TEST_F(ArchiveTest, RejectsWhatIsntAZip) {
+	Archive::Zip zip;
+	EXPECT_FALSE(zip.Open((dir / "none.zip").string()));
+	EXPECT_FALSE(zip.Open(Write("short.zip", { 'P', 'K' })));
+
+	std::vector<unsigned char> bytes = Build({ { "a.png", "a" } }, "");
+	// Directory offset past the end
+	bytes[bytes.size() - 3] = 0x7f;
+	EXPECT_FALSE(zip.Open(Write("broken.zip", bytes)));
+	EXPECT_EQ(zip.Members(), 0u);
+}
+
+TEST_F(ArchiveTest, SplitsAtTheArchive) {
+	const std::string path = Write("ui/icons.zip", Build({ { "a/b.png", "b" } }, ""));
+	std::string archive, member;
+	ASSERT_TRUE(Archive::Split(path + "/a/b.png", archive, member));
+	EXPECT_EQ(archive, path);
+	EXPECT_EQ(member, "a/b.png");
+
+	ASSERT_TRUE(Archive::Split(path + "\\a\\b.png", archive, member));
+	EXPECT_EQ(member, "a\\b.png");
+
+	// Only a path up to an existing file counts
+	EXPECT_FALSE(Archive::Split((dir / "ui/other.zip/a.png").string(), archive, member));
+	EXPECT_FALSE(Archive::Split(path, archive, member));
+	EXPECT_FALSE(Archive::Split((dir / "ui").string() + "/a.png", archive, member));
+
+	std::shared_ptr<const Archive::Zip> zip = Archive::Acquire(archive);
+	ASSERT_TRUE(zip);
+	EXPECT_EQ(Member(*zip, "A/B.PNG"), "b");
+	EXPECT_EQ(Archive::Acquire(archive), zip);
+	zip.reset();
+	Archive::Trim();
+	Archive::Trim();
+}
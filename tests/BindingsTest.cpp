@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "ImGuiTest.h"
+#include "sol_ImGui.h"
+
+// Counts operator new while armed. Lua allocates through its own allocator and ImGui through
+// malloc, so whatever is counted is a C++ temporary made by the binding layer.
+static std::atomic<bool> g_Armed{ false };
+static std::atomic<uint64_t> g_News{ 0 };
+
+void* operator new(size_t size) {
+	if (g_Armed.load(std::memory_order_relaxed))
+		g_News.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	std::free(p);
+}
+
+namespace {
+
+	// Every string is longer than any small-string buffer, so a std::string copy would hit the heap
+	const char* kFrame = R"(
+		function frame()
+			ImGui.Begin("A window title long enough to need the heap")
+			ImGui.Text("Some text that does not fit in a small string buffer")
+			ImGui.TextColored(1, 0.5, 0, 1, "Colored text that does not fit in a small string buffer")
+			ImGui.Button("A button label that does not fit in a small string buffer")
+			ImGui.Checkbox("A checkbox label that does not fit in a small string buffer", true)
+			ImGui.SliderFloat("A slider label that does not fit in a small string buffer", 0.5, 0, 1, "%.3f units of something")
+			ImGui.PushID("An id string that does not fit in a small string buffer")
+			ImGui.PopID()
+			ImGui.End()
+		end
+	)";
+
+}
+
+TEST_F(ImGuiTest, StringArgumentsAreBorrowed) {
+	sol::state lua;
+	lua.open_libraries(sol::lib::base);
+	sol::state_view view(lua);
+	sol_ImGui::Init(view);
+	lua.script(kFrame);
+	sol::protected_function frame = lua["frame"];
+	auto run = [&] {
+		ImGui::NewFrame();
+		const bool ok = frame().valid();
+		ImGui::Render();
+		return ok;
+	};
+
+	// Windows, ids and settings are created in the first frames
+	for (int i = 0; i < 3; i++)
+		ASSERT_TRUE(run());
+
+	g_News = 0;
+	g_Armed = true;
+	bool ok = true;
+	for (int i = 0; i < 10; i++)
+		ok = run() && ok;
+	g_Armed = false;
+
+	EXPECT_TRUE(ok);
+	EXPECT_EQ(g_News.load(), 0u);
+}
+
+TEST_F(ImGuiTest, NilStringArgumentsReadAsEmpty) {
+	sol::state lua;
+	lua.open_libraries(sol::lib::base);
+	sol::state_view view(lua);
+	sol_ImGui::Init(view);
+	lua.script(R"(
+		function frame()
+			ImGui.Begin("Nil strings")
+			ImGui.Text(nil)
+			ImGui.TextColored(1, 0.5, 0, 1, nil)
+			ImGui.PushID(nil)
+			ImGui.PopID()
+			ImGui.End()
+		end
+	)");
+	sol::protected_function frame = lua["frame"];
+	ImGui::NewFrame();
+	EXPECT_TRUE(frame().valid());
+	ImGui::Render();
+}
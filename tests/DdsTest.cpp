@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "Dds.h"
+
+namespace {
+
+	constexpr uint32_t FourCC(char a, char b, char c, char d) {
+		return uint32_t(uint8_t(a)) | uint32_t(uint8_t(b)) << 8 | uint32_t(uint8_t(c)) << 16 | uint32_t(uint8_t(d)) << 24;
+	}
+
+	// A DDS file as a writer would lay it out; fields are set through offsets into the header
+	struct File {
+		std::vector<unsigned char> bytes = std::vector<unsigned char>(4 + 124);
+
+		void Put(size_t offset, uint32_t value) {
+			if (bytes.size() < offset + 4)
+				bytes.resize(offset + 4);
+			for (int i = 0; i < 4; i++)
+				bytes[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+		}
+		// Header fields, counted from after the magic
+		void Header(size_t offset, uint32_t value) { Put(4 + offset, value); }
+
+		File(uint32_t width, uint32_t height, uint32_t mips) {
+			Put(0, FourCC('D', 'D', 'S', ' '));
+			Header(0, 124);
+			Header(8, height);
+			Header(12, width);
+			Header(24, mips);
+		}
+		void FourCCFormat(uint32_t fourCC) {
+			Header(76, 0x4);
+			Header(80, fourCC);
+		}
+		void Rgba() {
+			Header(76, 0x40 | 0x1);
+			Header(84, 32);
+			Header(88, 0x000000ff);
+			Header(92, 0x0000ff00);
+			Header(96, 0x00ff0000);
+			Header(100, 0xff000000);
+		}
+		void Dx10(uint32_t dxgi, uint32_t dimension = 3, uint32_t arraySize = 1) {
+			FourCCFormat(FourCC('D', 'X', '1', '0'));
+			Put(128, dxgi);
+			Put(132, dimension);
+			Put(136, 0);
+			Put(140, arraySize);
+			Put(144, 0);
+		}
+		// Pixel data counting up, so a copy at the wrong offset shows
+		void Payload(size_t size) {
+			const size_t start = bytes.size();
+			for (size_t i = 0; i < size; i++)
+				bytes.push_back(static_cast<unsigned char>(start + i));
+		}
+		bool Parse(TextureLoader::Image& out) const { return Dds::Parse(bytes.data(), bytes.size(), out); }
+	};
+
+}
+
+TEST(Dds, ReadsBc1WithMips) {
+	File file(8, 8, 4);
+	file.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+	// 8x8, 4x4, 2x2 and 1x1 are one or four 8-byte blocks each
+	file.Payload(32 + 8 + 8 + 8);
+	TextureLoader::Image image;
+	ASSERT_TRUE(file.Parse(image));
+	EXPECT_EQ(image.format, TextureLoader::Format::BC1);
+	EXPECT_EQ(image.width, 8);
+	EXPECT_EQ(image.height, 8);
+	EXPECT_EQ(image.mips, 4);
+	ASSERT_EQ(image.pixels.size(), 56u);
+	EXPECT_EQ(image.Data()[0], static_cast<unsigned char>(128));
+}
+
+TEST(Dds, ReadsBc3AndDx10Formats) {
+	TextureLoader::Image image;
+	File bc3(4, 4, 0);
+	bc3.FourCCFormat(FourCC('D', 'X', 'T', '5'));
+	bc3.Payload(16);
+	ASSERT_TRUE(bc3.Parse(image));
+	EXPECT_EQ(image.format, TextureLoader::Format::BC3);
+	// No mip count means one level
+	EXPECT_EQ(image.mips, 1);
+
+	File bc7(16, 8, 1);
+	bc7.Dx10(99);
+	bc7.Payload(8 * 16);
+	ASSERT_TRUE(bc7.Parse(image));
+	EXPECT_EQ(image.format, TextureLoader::Format::BC7);
+	EXPECT_EQ(image.pixels.size(), 128u);
+	EXPECT_EQ(image.Data()[0], static_cast<unsigned char>(148));
+}
+
+TEST(Dds, ReadsRgba) {
+	File file(3, 2, 1);
+	file.Rgba();
+	file.Payload(3 * 2 * 4);
+	TextureLoader::Image image;
+	ASSERT_TRUE(file.Parse(image));
+	EXPECT_EQ(image.format, TextureLoader::Format::RGBA8);
+	EXPECT_EQ(image.pixels.size(), 24u);
+
+	// BGRA channel order isn't swizzled, so it's refused
+	File bgra(3, 2, 1);
+	bgra.Rgba();
+	bgra.Header(88, 0x00ff0000);
+	bgra.Header(96, 0x000000ff);
+	bgra.Payload(24);
+	EXPECT_FALSE(bgra.Parse(image));
+}
+
+TEST(Dds, RejectsWhatIsntA2DTexture) {
+	TextureLoader::Image image;
+
+	File cubemap(4, 4, 1);
+	cubemap.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+	cubemap.Header(108, 0x200 | 0xfc00);
+	cubemap.Payload(8 * 6);
+	EXPECT_FALSE(cubemap.Parse(image));
+
+	File volume(4, 4, 1);
+	volume.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+	volume.Header(108, 0x200000);
+	volume.Header(20, 4);
+	volume.Payload(8 * 4);
+	EXPECT_FALSE(volume.Parse(image));
+
+	File depth(4, 4, 1);
+	depth.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+	depth.Header(20, 2);
+	depth.Payload(8 * 2);
+	EXPECT_FALSE(depth.Parse(image));
+
+	File array(4, 4, 1);
+	array.Dx10(71, 3, 2);
+	array.Payload(8 * 2);
+	EXPECT_FALSE(array.Parse(image));
+
+	File texture3d(4, 4, 1);
+	texture3d.Dx10(71, 4);
+	texture3d.Payload(8);
+	EXPECT_FALSE(texture3d.Parse(image));
+
+	File unsupported(4, 4, 1);
+	unsupported.Dx10(10);
+	unsupported.Payload(4 * 4 * 8);
+	EXPECT_FALSE(unsupported.Parse(image));
+}
+
+TEST(Dds, RejectsBadHeaders) {
+	TextureLoader::Image image;
+	auto bc1 = [](uint32_t width, uint32_t height, uint32_t mips) {
+		File file(width, height, mips);
+		file.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+		file.Payload(1 << 16);
+		return file;
+	};
+	EXPECT_TRUE(bc1(64, 64, 7).Parse(image));
+
+	EXPECT_FALSE(bc1(0, 64, 1).Parse(image));
+	EXPECT_FALSE(bc1(64, 0, 1).Parse(image));
+	EXPECT_FALSE(bc1(16385, 4, 1).Parse(image));
+	EXPECT_FALSE(bc1(4, 16385, 1).Parse(image));
+	// A 64x64 chain ends at the seventh level
+	EXPECT_FALSE(bc1(64, 64, 8).Parse(image));
+	EXPECT_FALSE(bc1(16384, 16384, 16).Parse(image));
+
+	File size = bc1(4, 4, 1);
+	size.Header(0, 128);
+	EXPECT_FALSE(size.Parse(image));
+
+	File magic = bc1(4, 4, 1);
+	magic.Put(0, FourCC('D', 'D', 'S', '!'));
+	EXPECT_FALSE(magic.Parse(image));
+
+	File dxt3 = bc1(4, 4, 1);
+	dxt3.FourCCFormat(FourCC('D', 'X', 'T', '3'));
+	EXPECT_FALSE(dxt3.Parse(image));
+}
+
+TEST(Dds, RejectsTruncatedFiles) {
+	TextureLoader::Image image;
+	File file(8, 8, 2);
+	file.FourCCFormat(FourCC('D', 'X', 'T', '1'));
+	file.Payload(32 + 8 - 1);
+	EXPECT_FALSE(file.Parse(image));
+	file.Payload(1);
+	EXPECT_TRUE(file.Parse(image));
+
+	// Cut inside the header, and inside the DX10 extension
+	EXPECT_FALSE(Dds::Parse(file.bytes.data(), 100, image));
+	File dx10(4, 4, 1);
+	dx10.Dx10(98);
+	EXPECT_FALSE(Dds::Parse(dx10.bytes.data(), 4 + 124 + 10, image));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "Descriptors.h"
+
+TEST(Descriptors, HandsOutEachSlotOnce) {
+	Descriptors::Allocator slots;
+	slots.Reset(8, 1);
+	std::set<uint32_t> seen;
+	for (int i = 0; i < 7; i++) {
+		const uint32_t slot = slots.Allocate();
+		ASSERT_NE(slot, Descriptors::kInvalid);
+		// Slot 0 is the font's
+		EXPECT_GE(slot, 1u);
+		EXPECT_LT(slot, 8u);
+		EXPECT_TRUE(seen.insert(slot).second) << slot;
+	}
+	EXPECT_EQ(slots.Used(), 7u);
+	EXPECT_EQ(slots.Allocate(), Descriptors::kInvalid);
+}
+
+TEST(Descriptors, FreedSlotsComeBack) {
+	Descriptors::Allocator slots;
+	slots.Reset(4, 1);
+	const uint32_t a = slots.Allocate();
+	const uint32_t b = slots.Allocate();
+	slots.Allocate();
+	EXPECT_EQ(slots.Allocate(), Descriptors::kInvalid);
+
+	slots.Free(a);
+	slots.Free(b);
+	EXPECT_EQ(slots.Used(), 1u);
+	// Last in, first out
+	EXPECT_EQ(slots.Allocate(), b);
+	EXPECT_EQ(slots.Allocate(), a);
+	EXPECT_EQ(slots.Allocate(), Descriptors::kInvalid);
+}
+
+TEST(Descriptors, IgnoresSlotsItNeverHandedOut) {
+	Descriptors::Allocator slots;
+	slots.Reset(8, 2);
+	slots.Free(0);
+	slots.Free(1);
+	slots.Free(5);
+	slots.Free(Descriptors::kInvalid);
+	EXPECT_EQ(slots.Used(), 0u);
+	EXPECT_EQ(slots.Allocate(), 2u);
+}
+
+TEST(Descriptors, GrowKeepsSlotsAndAddsRoom) {
+	Descriptors::Allocator slots;
+	slots.Reset(4, 1);
+	std::vector<uint32_t> held;
+	for (uint32_t slot; (slot = slots.Allocate()) != Descriptors::kInvalid;)
+		held.push_back(slot);
+	ASSERT_EQ(held.size(), 3u);
+
+	slots.Grow(8);
+	EXPECT_EQ(slots.Capacity(), 8u);
+	for (uint32_t slot; (slot = slots.Allocate()) != Descriptors::kInvalid;) {
+		EXPECT_EQ(std::count(held.begin(), held.end(), slot), 0);
+		held.push_back(slot);
+	}
+	EXPECT_EQ(held.size(), 7u);
+
+	// Never shrinks
+	slots.Grow(2);
+	EXPECT_EQ(slots.Capacity(), 8u);
+}
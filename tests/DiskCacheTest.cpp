@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "DiskCache.h"
+
+namespace {
+
+	namespace fs = std::filesystem;
+
+	// 4x4 RGBA with its 2x2 and 1x1 levels, every byte different
+	TextureLoader::Image Image() {
+		TextureLoader::Image image;
+		image.width = image.height = 4;
+		image.mips = 3;
+		for (int i = 0; i < (16 + 4 + 1) * 4; i++)
+			image.pixels.push_back(static_cast<unsigned char>(i * 7));
+		return image;
+	}
+
+	class DiskCacheTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			dir = (fs::temp_directory_path() / (std::string("LuaEngineUITests-") + ::testing::UnitTest::GetInstance()->current_test_info()->name())).string();
+			fs::remove_all(dir);
+			fs::create_directories(dir);
+		}
+
+		void TearDown() override {
+			DiskCache::SetDirectory("", 0);
+			std::error_code ec;
+			fs::remove_all(dir, ec);
+		}
+
+		// Patches one byte of a file in place
+		static void Poke(const std::string& file, size_t offset, char value) {
+			std::fstream io(file, std::ios::binary | std::ios::in | std::ios::out);
+			io.seekp(offset);
+			io.put(value);
+		}
+
+		static void Age(const std::string& file, std::chrono::hours age) {
+			fs::last_write_time(file, fs::file_time_type::clock::now() - age);
+		}
+
+		std::string dir;
+	};
+
+}
+
+TEST_F(DiskCacheTest, RoundTrips) {
+	const TextureLoader::Image image = Image();
+	const std::string file = DiskCache::Path(dir, 0x1234);
+	EXPECT_EQ(fs::path(file).filename(), "0000000000001234.ltx");
+	ASSERT_TRUE(DiskCache::Write(file, 0x1234, image));
+
+	TextureLoader::Image read;
+	ASSERT_TRUE(DiskCache::Read(file, 0x1234, read));
+	EXPECT_EQ(read.format, image.format);
+	EXPECT_EQ(read.width, 4);
+	EXPECT_EQ(read.height, 4);
+	EXPECT_EQ(read.mips, 3);
+	// Served from the mapping, not copied
+	EXPECT_TRUE(read.pixels.empty());
+	EXPECT_TRUE(std::equal(image.pixels.begin(), image.pixels.end(), read.Data()));
+	// Nothing but the entry is left behind
+	EXPECT_EQ(std::distance(fs::directory_iterator(dir), fs::directory_iterator()), 1);
+}
+
+TEST_F(DiskCacheTest, MissesWhatItCantTrust) {
+	const std::string file = DiskCache::Path(dir, 7);
+	ASSERT_TRUE(DiskCache::Write(file, 7, Image()));
+	const DiskCache::Stats before = DiskCache::GetStats();
+	TextureLoader::Image read;
+	EXPECT_FALSE(DiskCache::Read(file, 8, read));
+	EXPECT_FALSE(DiskCache::Read(DiskCache::Path(dir, 9), 9, read));
+	EXPECT_EQ(DiskCache::GetStats().misses - before.misses, 2u);
+
+	const std::string other = DiskCache::Path(dir, 10);
+	ASSERT_TRUE(DiskCache::Write(other, 10, Image()));
+	Poke(other, 4, static_cast<char>(DiskCache::kVersion + 1));
+	EXPECT_FALSE(DiskCache::Read(other, 10, read));
+
+	const std::string torn = DiskCache::Path(dir, 11);
+	ASSERT_TRUE(DiskCache::Write(torn, 11, Image()));
+	fs::resize_file(torn, fs::file_size(torn) - 1);
+	EXPECT_FALSE(DiskCache::Read(torn, 11, read));
+	fs::resize_file(torn, 40);
+	EXPECT_FALSE(DiskCache::Read(torn, 11, read));
+
+	EXPECT_TRUE(DiskCache::Read(file, 7, read));
+}
+
+TEST_F(DiskCacheTest, SweepRemovesWhatCanNeverHit) {
+	const std::string good = DiskCache::Path(dir, 1);
+	ASSERT_TRUE(DiskCache::Write(good, 1, Image()));
+	const std::string stale = DiskCache::Path(dir, 2);
+	ASSERT_TRUE(DiskCache::Write(stale, 2, Image()));
+	Poke(stale, 4, static_cast<char>(DiskCache::kVersion + 1));
+	const std::string torn = DiskCache::Path(dir, 3);
+	ASSERT_TRUE(DiskCache::Write(torn, 3, Image()));
+	fs::resize_file(torn, 64);
+	// Under a name Read would never look for
+	const std::string renamed = DiskCache::Path(dir, 4);
+	fs::copy_file(good, renamed);
+	const std::string abandoned = good + ".1234.tmp";
+	std::ofstream(abandoned) << "partial";
+	Age(abandoned, std::chrono::hours(2));
+	const std::string writing = good + ".5678.tmp";
+	std::ofstream(writing) << "partial";
+	const std::string foreign = dir + "/notes.tmp";
+	std::ofstream(foreign) << "not ours";
+	Age(foreign, std::chrono::hours(2));
+
+	const uint64_t removedBefore = DiskCache::GetStats().removed;
+	EXPECT_EQ(DiskCache::Sweep(dir, 0), 4u);
+	EXPECT_EQ(DiskCache::GetStats().removed - removedBefore, 4u);
+	EXPECT_TRUE(fs::exists(good));
+	EXPECT_FALSE(fs::exists(stale));
+	EXPECT_FALSE(fs::exists(torn));
+	EXPECT_FALSE(fs::exists(renamed));
+	EXPECT_FALSE(fs::exists(abandoned));
+	EXPECT_TRUE(fs::exists(writing));
+	EXPECT_TRUE(fs::exists(foreign));
+}
+
+TEST_F(DiskCacheTest, SweepKeepsTheRecentlyUsedUnderTheCap) {
+	const uint64_t entry = [&] {
+		const std::string file = DiskCache::Path(dir, 100);
+		DiskCache::Write(file, 100, Image());
+		return fs::file_size(file);
+	}();
+	for (uint64_t key = 101; key < 104; key++)
+		ASSERT_TRUE(DiskCache::Write(DiskCache::Path(dir, key), key, Image()));
+	// 100 oldest, 103 newest; a hit on an old entry counts as a use
+	for (uint64_t key = 100; key < 104; key++)
+		Age(DiskCache::Path(dir, key), std::chrono::hours(24 * 10 - key));
+	TextureLoader::Image read;
+	ASSERT_TRUE(DiskCache::Read(DiskCache::Path(dir, 100), 100, read));
+
+	EXPECT_EQ(DiskCache::Sweep(dir, entry * 4), 0u);
+	EXPECT_EQ(DiskCache::Sweep(dir, entry * 2), 2u);
+	EXPECT_TRUE(fs::exists(DiskCache::Path(dir, 100)));
+	EXPECT_FALSE(fs::exists(DiskCache::Path(dir, 101)));
+	EXPECT_FALSE(fs::exists(DiskCache::Path(dir, 102)));
+	EXPECT_TRUE(fs::exists(DiskCache::Path(dir, 103)));
+}
+
+TEST_F(DiskCacheTest, FirstWriteSweeps) {
+	const std::string stale = DiskCache::Path(dir, 1);
+	ASSERT_TRUE(DiskCache::Write(stale, 1, Image()));
+	Poke(stale, 4, static_cast<char>(DiskCache::kVersion + 1));
+
+	DiskCache::SetDirectory(dir, 0);
+	ASSERT_TRUE(DiskCache::Write(DiskCache::Path(dir, 2), 2, Image()));
+	EXPECT_FALSE(fs::exists(stale));
+
+	// Once a run, unless the settings change
+	ASSERT_TRUE(DiskCache::Write(stale, 1, Image()));
+	Poke(stale, 4, static_cast<char>(DiskCache::kVersion + 1));
+	ASSERT_TRUE(DiskCache::Write(DiskCache::Path(dir, 3), 3, Image()));
+	EXPECT_TRUE(fs::exists(stale));
+	DiskCache::SetDirectory(dir, 1 << 20);
+	ASSERT_TRUE(DiskCache::Write(DiskCache::Path(dir, 4), 4, Image()));
+	EXPECT_FALSE(fs::exists(stale));
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "ImGuiTest.h"
+#include "DrawSnapshot.h"
+
+namespace {
+
+	ImDrawData* Frame(int rows) {
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(10, 10));
+		ImGui::SetNextWindowSize(ImVec2(300, 400));
+		ImGui::Begin("Snapshot");
+		for (int i = 0; i < rows; i++)
+			ImGui::Text("row %d", i);
+		ImGui::End();
+		ImGui::Render();
+		return ImGui::GetDrawData();
+	}
+
+	std::vector<ImDrawVert> Vertices(const ImDrawData& data) {
+		std::vector<ImDrawVert> out;
+		for (int i = 0; i < data.CmdListsCount; i++)
+			out.insert(out.end(), data.CmdLists[i]->VtxBuffer.begin(), data.CmdLists[i]->VtxBuffer.end());
+		return out;
+	}
+
+	bool Same(const std::vector<ImDrawVert>& a, const std::vector<ImDrawVert>& b) {
+		return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(ImDrawVert)) == 0);
+	}
+
+}
+
+TEST_F(ImGuiTest, SnapshotIsIndependentOfTheContext) {
+	const ImDrawData& source = *Frame(10);
+	ASSERT_GT(source.CmdListsCount, 0);
+	DrawSnapshot::Snapshot snapshot;
+	DrawSnapshot::Copy(snapshot, source);
+
+	const std::vector<ImDrawVert> copied = Vertices(source);
+	EXPECT_TRUE(Same(Vertices(snapshot.data), copied));
+	EXPECT_EQ(snapshot.data.CmdListsCount, source.CmdListsCount);
+	EXPECT_EQ(snapshot.data.TotalVtxCount, source.TotalVtxCount);
+	EXPECT_EQ(snapshot.data.OwnerViewport, nullptr);
+	for (int i = 0; i < snapshot.data.CmdListsCount; i++) {
+		EXPECT_NE(snapshot.data.CmdLists[i], source.CmdLists[i]);
+		EXPECT_EQ(snapshot.data.CmdLists[i]->CmdBuffer.Size, source.CmdLists[i]->CmdBuffer.Size);
+		EXPECT_EQ(snapshot.data.CmdLists[i]->IdxBuffer.Size, source.CmdLists[i]->IdxBuffer.Size);
+	}
+
+	// The context moves on; the copy doesn't
+	Frame(30);
+	EXPECT_FALSE(Same(Vertices(*ImGui::GetDrawData()), copied));
+	EXPECT_TRUE(Same(Vertices(snapshot.data), copied));
+}
+
+TEST_F(ImGuiTest, SnapshotKeepsItsAllocations) {
+	DrawSnapshot::Snapshot snapshot;
+	DrawSnapshot::Copy(snapshot, *Frame(20));
+	ASSERT_GT(snapshot.data.CmdListsCount, 0);
+	const ImDrawVert* vertices = snapshot.data.CmdLists[0]->VtxBuffer.Data;
+
+	// A smaller frame fits in what the copy already has
+	DrawSnapshot::Copy(snapshot, *Frame(5));
+	EXPECT_EQ(snapshot.data.CmdLists[0]->VtxBuffer.Data, vertices);
+	EXPECT_TRUE(Same(Vertices(snapshot.data), Vertices(*ImGui::GetDrawData())));
+}
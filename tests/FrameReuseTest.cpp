@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "ImGuiTest.h"
+#include "FrameReuse.h"
+
+namespace {
+
+	ImDrawData* Frame(const char* text) {
+		ImGui::NewFrame();
+		ImGui::Begin("Reuse");
+		ImGui::TextUnformatted(text);
+		ImGui::End();
+		ImGui::Render();
+		return ImGui::GetDrawData();
+	}
+
+	ImDrawCmd& FirstCmd(ImDrawData& data) {
+		return data.CmdLists[0]->CmdBuffer[0];
+	}
+
+}
+
+TEST_F(ImGuiTest, FrameReuseHashFollowsContent) {
+	// An auto-sized window is laid out over its first frames
+	for (int i = 0; i < 3; i++)
+		Frame("same");
+
+	const uint64_t same = FrameReuse::Hash(*Frame("same"));
+	EXPECT_EQ(FrameReuse::Hash(*Frame("same")), same);
+	EXPECT_NE(FrameReuse::Hash(*Frame("other")), same);
+
+	ImDrawData& data = *Frame("same");
+	ASSERT_GT(data.CmdListsCount, 0);
+	EXPECT_EQ(FrameReuse::Hash(data), same);
+
+	ImDrawCmd& cmd = FirstCmd(data);
+	const ImTextureID texture = cmd.TextureId;
+	cmd.TextureId = (ImTextureID)(intptr_t)0x1234;
+	EXPECT_NE(FrameReuse::Hash(data), same);
+	cmd.TextureId = texture;
+
+	cmd.ClipRect.z += 1.0f;
+	EXPECT_NE(FrameReuse::Hash(data), same);
+	cmd.ClipRect.z -= 1.0f;
+
+	data.DisplaySize.x += 1.0f;
+	EXPECT_NE(FrameReuse::Hash(data), same);
+	data.DisplaySize.x -= 1.0f;
+	EXPECT_EQ(FrameReuse::Hash(data), same);
+}
+
+TEST(FrameReuse, ReusesOnlyWhileBuffersAreIntact) {
+	FrameReuse::Reset(2, 2);
+	EXPECT_FALSE(FrameReuse::CanReuse(0, 42));
+
+	FrameReuse::Recorded(0, 42);
+	EXPECT_TRUE(FrameReuse::CanReuse(0, 42));
+	EXPECT_FALSE(FrameReuse::CanReuse(0, 43));
+	EXPECT_FALSE(FrameReuse::CanReuse(1, 42));
+	EXPECT_FALSE(FrameReuse::CanReuse(2, 42));
+	EXPECT_TRUE(FrameReuse::MustDrain());
+
+	// The backend has two buffer sets: one more recording leaves buffer 0's set intact...
+	FrameReuse::Recorded(1, 7);
+	EXPECT_FALSE(FrameReuse::MustDrain());
+	EXPECT_TRUE(FrameReuse::CanReuse(0, 42));
+
+	// ...the next one overwrites it
+	FrameReuse::Recorded(1, 8);
+	EXPECT_FALSE(FrameReuse::CanReuse(0, 42));
+	EXPECT_TRUE(FrameReuse::CanReuse(1, 8));
+
+	FrameReuse::Reset(2, 2);
+	EXPECT_FALSE(FrameReuse::CanReuse(1, 8));
+}
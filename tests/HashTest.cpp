@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "Hash.h"
+
+namespace {
+
+	constexpr uint32_t kPrime32 = 2654435761u;
+
+	// The buffer xxHash's own sanity checks hash
+	std::vector<uint8_t> SanityBuffer(size_t size) {
+		std::vector<uint8_t> buffer(size);
+		uint64_t gen = kPrime32;
+		for (uint8_t& byte : buffer) {
+			byte = static_cast<uint8_t>(gen >> 56);
+			gen *= 11400714785074694797ull;
+		}
+		return buffer;
+	}
+
+}
+
+TEST(Hash, ReferenceVectors) {
+	const std::vector<uint8_t> buffer = SanityBuffer(256);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 0, 0), 0xEF46DB3751D8E999ull);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 1, 0), 0xE934A84ADB052768ull);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 1, kPrime32), 0x5014607643A9B4C3ull);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 14, 0), 0x8282DCC4994E35C8ull);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 222, 0), 0xB641AE8CB691C174ull);
+	EXPECT_EQ(Hash::Bytes(buffer.data(), 222, kPrime32), 0x20CB8AB7AE10C14Aull);
+}
+
+TEST(Hash, Strings) {
+	const char* fox = "The quick brown fox jumps over the lazy dog";
+	EXPECT_EQ(Hash::Bytes("", 0), 0xEF46DB3751D8E999ull);
+	EXPECT_EQ(Hash::Bytes("a", 1), 0xD24EC4F1A98C6E5Bull);
+	EXPECT_EQ(Hash::Bytes("abc", 3), 0x44BC2CF5AD770999ull);
+	EXPECT_EQ(Hash::Bytes(fox, strlen(fox)), 0x0B242D361FDA71BCull);
+}
+
+TEST(Hash, UnalignedInput) {
+	// Every tail length and start offset goes through the same unaligned reads
+	const std::vector<uint8_t> buffer = SanityBuffer(128);
+	std::vector<uint8_t> shifted(buffer.size() + 8);
+	for (size_t offset = 1; offset < 8; offset++) {
+		memcpy(shifted.data() + offset, buffer.data(), buffer.size());
+		for (size_t size = 0; size <= 100; size++)
+			EXPECT_EQ(Hash::Bytes(shifted.data() + offset, size, 7), Hash::Bytes(buffer.data(), size, 7)) << size;
+	}
+}
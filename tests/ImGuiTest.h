@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <imgui.h>
+
+// A real ImGui context with a fixed display size and a built font atlas but no renderer, which is
+// all NewFrame and Render need to produce draw data.
+class ImGuiTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.DisplaySize = ImVec2(1280, 720);
+		io.DeltaTime = 1.0f / 60.0f;
+		io.IniFilename = nullptr;
+		unsigned char* pixels;
+		int width, height;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+	}
+
+	void TearDown() override {
+		ImGui::DestroyContext();
+	}
+};
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <vector>
+
+#include "Mipmaps.h"
+
+namespace {
+
+	TextureLoader::Image Rgba(int width, int height, std::initializer_list<uint8_t> texels) {
+		TextureLoader::Image image;
+		image.width = width;
+		image.height = height;
+		image.mips = 1;
+		image.pixels.assign(texels);
+		return image;
+	}
+
+	// Pseudo-random texels; about a quarter of them fully transparent
+	TextureLoader::Image Noise(int width, int height) {
+		TextureLoader::Image image;
+		image.width = width;
+		image.height = height;
+		image.mips = 1;
+		image.pixels.resize(static_cast<size_t>(width) * height * 4);
+		uint32_t state = 0x9e3779b9u;
+		for (size_t i = 0; i < image.pixels.size(); i += 4) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			image.pixels[i] = static_cast<uint8_t>(state);
+			image.pixels[i + 1] = static_cast<uint8_t>(state >> 8);
+			image.pixels[i + 2] = static_cast<uint8_t>(state >> 16);
+			image.pixels[i + 3] = (state >> 30) == 0 ? 0 : static_cast<uint8_t>(state >> 24);
+		}
+		return image;
+	}
+
+	// The 1x1 level at the end of the chain
+	std::vector<int> Last(const TextureLoader::Image& image) {
+		const unsigned char* p = image.Data() + image.pixels.size() - 4;
+		return { p[0], p[1], p[2], p[3] };
+	}
+
+}
+
+TEST(Mipmaps, Count) {
+	EXPECT_EQ(Mipmaps::Count(1, 1), 1);
+	EXPECT_EQ(Mipmaps::Count(2, 1), 2);
+	EXPECT_EQ(Mipmaps::Count(5, 3), 3);
+	EXPECT_EQ(Mipmaps::Count(256, 16), 9);
+	EXPECT_EQ(Mipmaps::Count(1, 16384), 15);
+}
+
+TEST(Mipmaps, AveragesInLinearLight) {
+	// Black and white meet at linear 0.5, which is 188 in sRGB rather than 128
+	TextureLoader::Image image = Rgba(2, 1, { 0, 0, 0, 255, 255, 255, 255, 255 });
+	ASSERT_TRUE(Mipmaps::Generate(image));
+	EXPECT_EQ(image.mips, 2);
+	EXPECT_EQ(Last(image), (std::vector<int>{ 188, 188, 188, 255 }));
+}
+
+TEST(Mipmaps, WeightsByAlpha) {
+	// The transparent texel's black doesn't darken the edge, it only halves coverage
+	TextureLoader::Image image = Rgba(2, 1, { 255, 255, 255, 255, 0, 0, 0, 0 });
+	ASSERT_TRUE(Mipmaps::Generate(image));
+	EXPECT_EQ(Last(image), (std::vector<int>{ 255, 255, 255, 128 }));
+
+	// All transparent keeps the plain average
+	TextureLoader::Image clear = Rgba(2, 2, { 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0 });
+	ASSERT_TRUE(Mipmaps::Generate(clear));
+	EXPECT_EQ(Last(clear), (std::vector<int>{ 255, 0, 0, 0 }));
+}
+
+TEST(Mipmaps, BuildsTheWholeChain) {
+	TextureLoader::Image image;
+	image.width = 5;
+	image.height = 3;
+	image.mips = 1;
+	image.pixels.assign(5 * 3 * 4, 200);
+	ASSERT_TRUE(Mipmaps::Generate(image));
+	// 5x3, 2x1 and 1x1; odd edges are dropped, so a flat image stays flat
+	EXPECT_EQ(image.mips, 3);
+	ASSERT_EQ(image.pixels.size(), size_t(15 + 2 + 1) * 4);
+	for (size_t i = 15 * 4; i < image.pixels.size(); i++)
+		EXPECT_NEAR(image.pixels[i], 200, 1) << i;
+}
+
+TEST(Mipmaps, LeavesOtherImagesAlone) {
+	TextureLoader::Image bc1;
+	bc1.format = TextureLoader::Format::BC1;
+	bc1.width = bc1.height = 4;
+	bc1.mips = 1;
+	bc1.pixels.assign(8, 0);
+	EXPECT_FALSE(Mipmaps::Generate(bc1));
+	EXPECT_EQ(bc1.pixels.size(), 8u);
+
+	TextureLoader::Image mipped = Rgba(2, 1, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 });
+	mipped.mips = 2;
+	EXPECT_FALSE(Mipmaps::Generate(mipped));
+	EXPECT_EQ(mipped.pixels.size(), 12u);
+}
+
+TEST(Mipmaps, KernelsAgree) {
+	if (!Mipmaps::HasSse2())
+		GTEST_SKIP() << "no SSE2 kernel in this build";
+	// Odd extents, so the clamped edges are covered too
+	TextureLoader::Image scalar = Noise(257, 131);
+	TextureLoader::Image sse2 = scalar;
+	ASSERT_TRUE(Mipmaps::Generate(scalar, Mipmaps::Kernel::Scalar));
+	ASSERT_TRUE(Mipmaps::Generate(sse2, Mipmaps::Kernel::Sse2));
+	ASSERT_EQ(scalar.mips, sse2.mips);
+	ASSERT_EQ(scalar.pixels.size(), sse2.pixels.size());
+	// The kernels sum in a different order, which may round a channel the other way
+	int worst = 0;
+	for (size_t i = 0; i < scalar.pixels.size(); i++)
+		worst = std::max(worst, std::abs(scalar.pixels[i] - sse2.pixels[i]));
+	EXPECT_LE(worst, 1);
+}
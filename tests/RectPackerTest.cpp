@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "RectPacker.h"
+
+namespace {
+
+	struct Rect {
+		int x, y, w, h;
+	};
+
+	bool Overlap(const Rect& a, const Rect& b) {
+		return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+	}
+
+}
+
+TEST(RectPacker, FillsExactly) {
+	RectPacker::Skyline packer;
+	packer.Reset(64, 64);
+	int x, y;
+	for (int i = 0; i < 16; i++) {
+		ASSERT_TRUE(packer.Insert(16, 16, x, y)) << i;
+		EXPECT_EQ(x % 16, 0);
+		EXPECT_EQ(y % 16, 0);
+	}
+	EXPECT_FLOAT_EQ(packer.Occupancy(), 1.0f);
+	EXPECT_FALSE(packer.Insert(1, 1, x, y));
+}
+
+TEST(RectPacker, RejectsWhatCantFit) {
+	RectPacker::Skyline packer;
+	packer.Reset(64, 32);
+	int x, y;
+	EXPECT_FALSE(packer.Insert(65, 1, x, y));
+	EXPECT_FALSE(packer.Insert(1, 33, x, y));
+	EXPECT_FALSE(packer.Insert(0, 4, x, y));
+	EXPECT_FALSE(packer.Insert(4, -1, x, y));
+	EXPECT_FLOAT_EQ(packer.Occupancy(), 0.0f);
+	EXPECT_TRUE(packer.Insert(64, 32, x, y));
+	EXPECT_EQ(x, 0);
+	EXPECT_EQ(y, 0);
+}
+
+TEST(RectPacker, MixedSizesStayInBoundsAndApart) {
+	constexpr int kWidth = 512, kHeight = 512;
+	RectPacker::Skyline packer;
+	packer.Reset(kWidth, kHeight);
+	std::mt19937 rng(3);
+	std::vector<Rect> placed;
+	int64_t area = 0;
+	for (int i = 0; i < 2000; i++) {
+		Rect rect{ 0, 0, 4 + int(rng() % 60), 4 + int(rng() % 60) };
+		if (!packer.Insert(rect.w, rect.h, rect.x, rect.y))
+			continue;
+		ASSERT_GE(rect.x, 0);
+		ASSERT_GE(rect.y, 0);
+		ASSERT_LE(rect.x + rect.w, kWidth);
+		ASSERT_LE(rect.y + rect.h, kHeight);
+		for (const Rect& other : placed)
+			ASSERT_FALSE(Overlap(rect, other)) << i;
+		placed.push_back(rect);
+		area += int64_t(rect.w) * rect.h;
+	}
+	EXPECT_GT(placed.size(), 100u);
+	EXPECT_FLOAT_EQ(packer.Occupancy(), float(area) / (kWidth * kHeight));
+	EXPECT_GT(packer.Occupancy(), 0.6f);
+}
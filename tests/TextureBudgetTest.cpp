@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "TextureBudget.h"
+
+namespace {
+
+	std::vector<uint64_t> Select(const TextureBudget::Tracker& tracker, uint64_t budget, uint64_t frame, uint64_t minAge) {
+		std::vector<uint64_t> out;
+		tracker.Select(budget, frame, minAge, out);
+		return out;
+	}
+
+}
+
+TEST(TextureBudget, CountsBytes) {
+	TextureBudget::Tracker tracker;
+	tracker.Add(1, 100, 0);
+	tracker.Add(2, 50, 0);
+	EXPECT_EQ(tracker.Bytes(), 150u);
+	EXPECT_EQ(tracker.Count(), 2u);
+
+	// Adding an id again replaces it
+	tracker.Add(1, 30, 5);
+	EXPECT_EQ(tracker.Bytes(), 80u);
+	EXPECT_EQ(tracker.Count(), 2u);
+
+	tracker.Remove(2);
+	tracker.Remove(2);
+	tracker.Remove(99);
+	EXPECT_EQ(tracker.Bytes(), 30u);
+	EXPECT_EQ(tracker.Count(), 1u);
+	tracker.Touch(99, 10);
+	EXPECT_EQ(tracker.Count(), 1u);
+}
+
+TEST(TextureBudget, EvictsLeastRecentlyDrawnFirst) {
+	TextureBudget::Tracker tracker;
+	for (uint64_t id = 1; id <= 4; id++)
+		tracker.Add(id, 100, id);
+	// 2 is drawn again after the others, 1 is re-added, which counts as new
+	tracker.Touch(2, 10);
+	tracker.Add(1, 100, 11);
+	// Order is now 3, 4, 2, 1
+	EXPECT_EQ(Select(tracker, 400, 100, 1), (std::vector<uint64_t>{}));
+	EXPECT_EQ(Select(tracker, 350, 100, 1), (std::vector<uint64_t>{ 3 }));
+	EXPECT_EQ(Select(tracker, 200, 100, 1), (std::vector<uint64_t>{ 3, 4 }));
+	EXPECT_EQ(Select(tracker, 0, 100, 1), (std::vector<uint64_t>{ 3, 4, 2, 1 }));
+	// Select only picks; nothing is dropped until the caller removes it
+	EXPECT_EQ(tracker.Bytes(), 400u);
+}
+
+TEST(TextureBudget, KeepsRecentDrawsOverBudget) {
+	TextureBudget::Tracker tracker;
+	tracker.Add(1, 100, 10);
+	tracker.Add(2, 100, 20);
+	tracker.Add(3, 100, 30);
+	// At frame 40 with a minimum age of 15, only what was drawn up to frame 25 may go
+	EXPECT_EQ(Select(tracker, 0, 40, 15), (std::vector<uint64_t>{ 1, 2 }));
+	EXPECT_EQ(Select(tracker, 0, 40, 21), (std::vector<uint64_t>{ 1 }));
+	// Drawn exactly minAge frames ago is old enough
+	EXPECT_EQ(Select(tracker, 0, 40, 30), (std::vector<uint64_t>{ 1 }));
+	EXPECT_EQ(Select(tracker, 0, 40, 31), (std::vector<uint64_t>{}));
+
+	// A draw moves an item behind the cut-off even when it was the oldest
+	tracker.Touch(1, 39);
+	EXPECT_EQ(Select(tracker, 0, 40, 15), (std::vector<uint64_t>{ 2 }));
+}
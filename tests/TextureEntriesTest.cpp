@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "TextureEntries.h"
+
+namespace {
+
+	struct Job {
+		uint64_t handle;
+		std::string path;
+		bool mips;
+	};
+
+	// What the stub renderer and loader were asked to do
+	bool g_Refuse = false;
+	uint64_t g_NextId = 1;
+	std::vector<uint64_t> g_Released;
+	std::vector<Job> g_Jobs;
+
+	bool StubUpload(const TextureLoader::Image& image, TextureEntries::Texture& out) {
+		if (g_Refuse)
+			return false;
+		out.id = g_NextId++;
+		out.width = image.width;
+		out.height = image.height;
+		return true;
+	}
+
+	void StubRelease(const TextureEntries::Texture& texture) {
+		g_Released.push_back(texture.id);
+	}
+
+	void StubSubmit(uint64_t job, std::string path, bool mips) {
+		g_Jobs.push_back({ job, std::move(path), mips });
+	}
+
+	TextureLoader::Image Image(int width, int height) {
+		TextureLoader::Image image;
+		image.width = width;
+		image.height = height;
+		image.pixels.resize(static_cast<size_t>(width) * height * 4);
+		return image;
+	}
+
+	class TextureEntriesTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			g_Refuse = false;
+			g_NextId = 1;
+			g_Released.clear();
+			g_Jobs.clear();
+			ctx.upload = StubUpload;
+			ctx.release = StubRelease;
+			ctx.submit = StubSubmit;
+			slot.path = "maps/forest.png";
+		}
+
+		TextureEntries::Context ctx;
+		TextureEntries::Slot slot;
+	};
+
+}
+
+using TextureEntries::Status;
+
+TEST_F(TextureEntriesTest, QueuedLoadBecomesReady) {
+	slot.mips = true;
+	TextureEntries::Queue(ctx, 7, slot);
+	EXPECT_EQ(slot.status, Status::Loading);
+	EXPECT_TRUE(slot.queued);
+	ASSERT_EQ(g_Jobs.size(), 1u);
+	EXPECT_EQ(g_Jobs[0].handle, 7u);
+	EXPECT_EQ(g_Jobs[0].path, "maps/forest.png");
+	EXPECT_TRUE(g_Jobs[0].mips);
+	EXPECT_FALSE(TextureEntries::Draw(ctx, 7, slot));
+
+	ASSERT_TRUE(TextureEntries::Accept(slot));
+	EXPECT_FALSE(slot.queued);
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 7, slot, Image(4, 2)));
+	EXPECT_EQ(slot.status, Status::Ready);
+	EXPECT_EQ(slot.texture.width, 4);
+	EXPECT_EQ(slot.texture.height, 2);
+	EXPECT_EQ(ctx.budget.Bytes(), 32u);
+	EXPECT_TRUE(TextureEntries::Draw(ctx, 7, slot));
+	EXPECT_FALSE(TextureEntries::NeedsLoad(slot));
+}
+
+TEST_F(TextureEntriesTest, RefusedUploadFails) {
+	TextureEntries::Queue(ctx, 1, slot);
+	ASSERT_TRUE(TextureEntries::Accept(slot));
+	g_Refuse = true;
+	EXPECT_FALSE(TextureEntries::Upload(ctx, 1, slot, Image(4, 4)));
+	EXPECT_EQ(slot.status, Status::Failed);
+	EXPECT_EQ(ctx.budget.Bytes(), 0u);
+	EXPECT_FALSE(TextureEntries::Draw(ctx, 1, slot));
+	EXPECT_FALSE(TextureEntries::NeedsLoad(slot));
+	// Nothing was created, so nothing is released
+	TextureEntries::Free(ctx, 1, slot);
+	EXPECT_TRUE(g_Released.empty());
+
+	// Without a renderer there is nothing to upload to
+	TextureEntries::Slot other;
+	ctx.upload = nullptr;
+	EXPECT_FALSE(TextureEntries::Upload(ctx, 2, other, Image(4, 4)));
+	EXPECT_EQ(other.status, Status::Failed);
+}
+
+TEST_F(TextureEntriesTest, EvictedKeepsItsSizeAndLoadsAgainWhenDrawn) {
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 3, slot, Image(8, 4)));
+	const uint64_t id = slot.texture.id;
+	TextureEntries::Evict(ctx, 3, slot);
+	EXPECT_EQ(slot.status, Status::Evicted);
+	EXPECT_EQ(g_Released, std::vector<uint64_t>{ id });
+	EXPECT_EQ(slot.texture.id, 0u);
+	EXPECT_EQ(slot.texture.width, 8);
+	EXPECT_EQ(slot.texture.height, 4);
+	EXPECT_EQ(ctx.budget.Bytes(), 0u);
+	EXPECT_EQ(ctx.evictions, 1u);
+	EXPECT_TRUE(TextureEntries::NeedsLoad(slot));
+
+	// The first draw queues it; later ones wait for that job
+	EXPECT_FALSE(TextureEntries::Draw(ctx, 3, slot));
+	EXPECT_EQ(slot.status, Status::Loading);
+	EXPECT_FALSE(TextureEntries::Draw(ctx, 3, slot));
+	EXPECT_EQ(g_Jobs.size(), 1u);
+
+	ASSERT_TRUE(TextureEntries::Accept(slot));
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 3, slot, Image(8, 4)));
+	EXPECT_TRUE(TextureEntries::Draw(ctx, 3, slot));
+}
+
+TEST_F(TextureEntriesTest, EvictedWithAJobInFlightWaitsForIt) {
+	TextureEntries::Queue(ctx, 4, slot);
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 4, slot, Image(4, 4)));
+	TextureEntries::Evict(ctx, 4, slot);
+	EXPECT_TRUE(slot.queued);
+	EXPECT_FALSE(TextureEntries::Draw(ctx, 4, slot));
+	EXPECT_EQ(slot.status, Status::Loading);
+	EXPECT_EQ(g_Jobs.size(), 1u);
+	EXPECT_TRUE(TextureEntries::Accept(slot));
+}
+
+TEST_F(TextureEntriesTest, SyncLoadOvertakesAQueuedJob) {
+	TextureEntries::Queue(ctx, 5, slot);
+	// LoadTexture on the same file before the worker is done
+	ASSERT_TRUE(TextureEntries::NeedsLoad(slot));
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 5, slot, Image(4, 4)));
+	const uint64_t id = slot.texture.id;
+
+	// The worker's result is dropped and the texture stays
+	EXPECT_FALSE(TextureEntries::Accept(slot));
+	EXPECT_FALSE(slot.queued);
+	EXPECT_EQ(slot.status, Status::Ready);
+	EXPECT_EQ(slot.texture.id, id);
+	EXPECT_TRUE(g_Released.empty());
+}
+
+TEST_F(TextureEntriesTest, ResetQueuesAgainAndKeepsTheSize) {
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 6, slot, Image(16, 8)));
+	const uint64_t id = slot.texture.id;
+	TextureEntries::Reset(ctx, 6, slot);
+	EXPECT_EQ(g_Released, std::vector<uint64_t>{ id });
+	EXPECT_EQ(slot.status, Status::Loading);
+	EXPECT_TRUE(slot.queued);
+	EXPECT_EQ(slot.texture.width, 16);
+	EXPECT_EQ(slot.texture.height, 8);
+	EXPECT_EQ(ctx.budget.Bytes(), 0u);
+	ASSERT_EQ(g_Jobs.size(), 1u);
+	EXPECT_EQ(g_Jobs[0].handle, 6u);
+
+	// A job already in flight is not queued twice
+	TextureEntries::Reset(ctx, 6, slot);
+	EXPECT_EQ(slot.status, Status::Loading);
+	EXPECT_EQ(g_Jobs.size(), 1u);
+}
+
+TEST_F(TextureEntriesTest, ResetLeavesIconsAndEvictedAlone) {
+	TextureEntries::Slot icon;
+	icon.icon = true;
+	icon.status = Status::Ready;
+	icon.texture.width = 32;
+	TextureEntries::Reset(ctx, 1, icon);
+	EXPECT_EQ(icon.status, Status::Ready);
+	EXPECT_EQ(icon.texture.width, 32);
+
+	ASSERT_TRUE(TextureEntries::Upload(ctx, 2, slot, Image(4, 4)));
+	TextureEntries::Evict(ctx, 2, slot);
+	g_Released.clear();
+	TextureEntries::Reset(ctx, 2, slot);
+	EXPECT_EQ(slot.status, Status::Evicted);
+	EXPECT_TRUE(g_Released.empty());
+	EXPECT_TRUE(g_Jobs.empty());
+}
+
+TEST_F(TextureEntriesTest, FreeingAnIconReleasesNothing) {
+	slot.icon = true;
+	slot.status = Status::Ready;
+	slot.texture.id = 9;
+	TextureEntries::Free(ctx, 1, slot);
+	EXPECT_TRUE(g_Released.empty());
+	EXPECT_EQ(slot.texture.id, 0u);
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TextureLoader.h"
+
+namespace {
+
+	// Waits for `count` results, or gives up after a few seconds
+	std::vector<TextureLoader::Result> CollectAll(size_t count) {
+		std::vector<TextureLoader::Result> out;
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		while (out.size() < count && std::chrono::steady_clock::now() < deadline) {
+			TextureLoader::Collect(out);
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return out;
+	}
+
+}
+
+TEST(TextureLoader, WorkersStopAndComeBack) {
+	for (uint64_t job = 1; job <= 8; job++)
+		TextureLoader::Submit(job, "missing/" + std::to_string(job) + ".png");
+	std::vector<TextureLoader::Result> results = CollectAll(8);
+	ASSERT_EQ(results.size(), 8u);
+	for (const TextureLoader::Result& result : results)
+		EXPECT_FALSE(result.ok);
+	EXPECT_EQ(TextureLoader::Pending(), 0u);
+	EXPECT_EQ(TextureLoader::Done(), 0u);
+
+	TextureLoader::Stop();
+	// Stopping twice, or with nothing running, is fine
+	TextureLoader::Stop();
+
+	TextureLoader::Submit(9, "missing/9.png");
+	results = CollectAll(1);
+	ASSERT_EQ(results.size(), 1u);
+	EXPECT_EQ(results[0].job, 9u);
+	TextureLoader::Stop();
+}
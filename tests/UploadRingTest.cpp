@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+
+#include "UploadRing.h"
+
+namespace {
+
+	struct Live {
+		uint64_t offset;
+		uint64_t size;
+		uint64_t fence;
+	};
+
+}
+
+TEST(UploadRing, AlignsAndCountsPadding) {
+	UploadRing::Ring ring;
+	ring.Reset(256);
+	EXPECT_EQ(ring.Allocate(10, 1, 1), 0u);
+	EXPECT_EQ(ring.Allocate(16, 64, 1), 64u);
+	EXPECT_EQ(ring.Used(), 80u);
+	EXPECT_EQ(ring.Allocate(0, 1, 1), UploadRing::kFull);
+	EXPECT_EQ(ring.Allocate(257, 1, 1), UploadRing::kFull);
+}
+
+TEST(UploadRing, WrapsOnceTheStartRetires) {
+	UploadRing::Ring ring;
+	ring.Reset(256);
+	EXPECT_EQ(ring.Allocate(100, 1, 1), 0u);
+	EXPECT_EQ(ring.Allocate(100, 1, 2), 100u);
+	// No room at the end, and the start is still in flight
+	EXPECT_EQ(ring.Allocate(100, 1, 3), UploadRing::kFull);
+
+	ring.Retire(1);
+	EXPECT_EQ(ring.Used(), 100u);
+	EXPECT_EQ(ring.Allocate(100, 1, 3), 0u);
+	// The 56 bytes skipped at the end count until the wrap retires
+	EXPECT_EQ(ring.Used(), 256u);
+	EXPECT_EQ(ring.Allocate(1, 1, 3), UploadRing::kFull);
+
+	ring.Retire(2);
+	EXPECT_EQ(ring.Used(), 156u);
+	ring.Retire(3);
+	EXPECT_EQ(ring.Used(), 0u);
+	EXPECT_EQ(ring.Allocate(256, 1, 4), 0u);
+}
+
+TEST(UploadRing, LiveAllocationsNeverOverlap) {
+	constexpr uint64_t kSize = 4096;
+	UploadRing::Ring ring;
+	ring.Reset(kSize);
+	std::mt19937 rng(7);
+	std::deque<Live> live;
+	uint64_t fence = 1, completed = 0;
+	int wraps = 0;
+	uint64_t last = 0;
+
+	for (int i = 0; i < 20000; i++) {
+		const uint64_t size = 1 + rng() % 700;
+		const uint64_t alignment = uint64_t(1) << (rng() % 9);
+		const uint64_t offset = ring.Allocate(size, alignment, fence);
+		if (offset == UploadRing::kFull) {
+			// Only ever full with something in flight
+			ASSERT_FALSE(live.empty());
+			ring.Retire(++completed);
+			while (!live.empty() && live.front().fence <= completed)
+				live.pop_front();
+			continue;
+		}
+		ASSERT_EQ(offset % alignment, 0u);
+		ASSERT_LE(offset + size, kSize);
+		for (const Live& other : live)
+			ASSERT_TRUE(offset + size <= other.offset || other.offset + other.size <= offset) << i;
+		wraps += offset < last;
+		last = offset;
+		live.push_back({ offset, size, fence });
+		if (rng() % 4 == 0)
+			fence++;
+	}
+	EXPECT_GT(wraps, 10);
+
+	ring.Retire(fence);
+	EXPECT_EQ(ring.Used(), 0u);
+}